@@ -0,0 +1,960 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "toolbox.h"
+#include "text-file-reader.h"
+
+// toolbox-bench [filter]
+//
+// One line per measure, whitespace separated so runs can be diffed or loaded in a spreadsheet:
+//   name param ops ns_per_op allocs_per_op alloc_bytes_per_op mb_per_s
+// Lines starting with '#' are comments (build flags, skipped sizes).
+
+#define BENCH_BUDGET_NS 20000000000ULL // a size projected to take longer is skipped
+
+static uint64_t g_bench_allocs = 0;
+static uint64_t g_bench_alloc_bytes = 0;
+static const char * g_bench_filter = NULL;
+static char g_bench_directory[256] = "";
+
+#if defined(__GLIBC__)
+// counts every allocation of the process, glibc lets the executable replace malloc
+extern void * __libc_malloc(size_t size);
+extern void * __libc_calloc(size_t count, size_t size);
+extern void * __libc_realloc(void * pointer, size_t size);
+extern void __libc_free(void * pointer);
+
+void * malloc(size_t size)
+{
+	__atomic_fetch_add(&g_bench_allocs, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&g_bench_alloc_bytes, size, __ATOMIC_RELAXED);
+	return __libc_malloc(size);
+}
+
+void * calloc(size_t count, size_t size)
+{
+	__atomic_fetch_add(&g_bench_allocs, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&g_bench_alloc_bytes, count * size, __ATOMIC_RELAXED);
+	return __libc_calloc(count, size);
+}
+
+void * realloc(void * pointer, size_t size)
+{
+	__atomic_fetch_add(&g_bench_allocs, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&g_bench_alloc_bytes, size, __ATOMIC_RELAXED);
+	return __libc_realloc(pointer, size);
+}
+
+void free(void * pointer)
+{
+	__libc_free(pointer);
+}
+#endif
+
+typedef struct benchMeasure_S
+{
+	const char * name;
+	char param[64];
+	uint64_t ops;
+	uint64_t bytes; // 0 if throughput does not apply
+	uint64_t start_ns;
+	uint64_t elapsed_ns;
+	uint64_t start_allocs;
+	uint64_t start_alloc_bytes;
+	uint64_t allocs;
+	uint64_t alloc_bytes;
+} benchMeasure_T;
+
+static int bench_wanted(const char * name)
+{
+	return g_bench_filter == NULL || strstr(name, g_bench_filter) != NULL;
+}
+
+static void bench_begin(benchMeasure_T * measure, const char * name, const char * param)
+{
+	memset(measure, 0, sizeof(benchMeasure_T));
+	measure->name = name;
+	snprintf(measure->param, sizeof(measure->param), "%s", param);
+	measure->start_allocs = __atomic_load_n(&g_bench_allocs, __ATOMIC_RELAXED);
+	measure->start_alloc_bytes = __atomic_load_n(&g_bench_alloc_bytes, __ATOMIC_RELAXED);
+	measure->start_ns = C_MonotonicNs();
+}
+
+static void bench_end(benchMeasure_T * measure, uint64_t ops, uint64_t bytes)
+{
+	double ops_divider;
+
+	measure->elapsed_ns = C_MonotonicNs() - measure->start_ns;
+	measure->allocs = __atomic_load_n(&g_bench_allocs, __ATOMIC_RELAXED) - measure->start_allocs;
+	measure->alloc_bytes = __atomic_load_n(&g_bench_alloc_bytes, __ATOMIC_RELAXED) - measure->start_alloc_bytes;
+	measure->ops = ops;
+	measure->bytes = bytes;
+
+	ops_divider = ops ? (double)ops : 1.0;
+	printf("%s %s %llu %.1f %.3f %.1f %.1f\n", measure->name, measure->param, (unsigned long long)ops,
+		(double)measure->elapsed_ns / ops_divider,
+		(double)measure->allocs / ops_divider,
+		(double)measure->alloc_bytes / ops_divider,
+		measure->elapsed_ns ? (double)bytes * 1000.0 / (double)measure->elapsed_ns : 0.0); // bytes per ns * 1000 = MB/s
+	fflush(stdout);
+}
+
+// for cases that grow faster than linear, previous is the last measure of the same case
+static int bench_tooSlow(const benchMeasure_T * previous, uint64_t previous_size, uint64_t size, int exponent)
+{
+	double projected;
+	int i;
+
+	if ( previous == NULL || previous->elapsed_ns == 0 )
+	{
+		return 0;
+	}
+	projected = (double)previous->elapsed_ns;
+	for (i = 0; i < exponent; i++)
+	{
+		projected *= (double)size / (double)previous_size;
+	}
+	if ( projected > (double)BENCH_BUDGET_NS )
+	{
+		printf("# %s %llu skipped, projected %.0f s\n", previous->name, (unsigned long long)size, projected / 1e9);
+		return 1;
+	}
+	return 0;
+}
+
+static void bench_append(void)
+{
+	static const unsigned int counts[] = { 1000, 10000, 100000 };
+	benchMeasure_T measure;
+	benchMeasure_T * previous = NULL;
+	char param[64];
+	unsigned int i;
+	unsigned int j;
+
+	if ( bench_wanted("C_Append") == 0 )
+	{
+		return;
+	}
+	for (i = 0; i < sizeof(counts)/sizeof(counts[0]); i++)
+	{
+		char * string = NULL;
+		unsigned int buffersize = 0;
+
+		if ( i > 0 && bench_tooSlow(previous, counts[i-1], counts[i], 2) )
+		{
+			break;
+		}
+		snprintf(param, sizeof(param), "%u", counts[i]);
+		bench_begin(&measure, "C_Append", param);
+		for (j = 0; j < counts[i]; j++)
+		{
+			C_Append(&string, &buffersize, "0123456789abcdef", -1, NULL);
+		}
+		bench_end(&measure, counts[i], (uint64_t)counts[i] * 16);
+		previous = &measure;
+		free(string);
+	}
+}
+
+static void bench_search(void)
+{
+	static const unsigned int needle_lengths[] = { 1, 4, 16, 64, 256 };
+	const unsigned int haystack_length = 1024 * 1024;
+	const unsigned int repeat = 20;
+	unsigned char * haystack;
+	unsigned char needle[257];
+	char upper_needle[257];
+	benchMeasure_T measure;
+	char param[64];
+	unsigned char * position;
+	unsigned int i;
+	unsigned int j;
+	unsigned int k;
+	uint32_t seed = 12345;
+
+	if ( bench_wanted("C_memfind") == 0 && bench_wanted("C_memFind") == 0 && bench_wanted("C_strcasestr") == 0 )
+	{
+		return;
+	}
+
+	// letters a..y, the needles end with 'z' so they are never found and the whole haystack is scanned
+	haystack = (unsigned char*)malloc(haystack_length + 1);
+	if ( haystack == NULL )
+	{
+		return;
+	}
+	for (i = 0; i < haystack_length; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		haystack[i] = 'a' + (unsigned char)((seed >> 16) % 25);
+	}
+	haystack[haystack_length] = '\0';
+
+	for (i = 0; i < sizeof(needle_lengths)/sizeof(needle_lengths[0]); i++)
+	{
+		const unsigned int length = needle_lengths[i];
+
+		memcpy(needle, haystack + haystack_length / 2, length - 1);
+		needle[length - 1] = 'z';
+		needle[length] = '\0';
+		for (k = 0; k <= length; k++)
+		{
+			upper_needle[k] = (needle[k] >= 'a' && needle[k] <= 'z') ? needle[k] - 'a' + 'A' : needle[k];
+		}
+		snprintf(param, sizeof(param), "needle=%u", length);
+
+		if ( bench_wanted("C_memfind") )
+		{
+			bench_begin(&measure, "C_memfind", param);
+			for (j = 0; j < repeat; j++)
+			{
+				if ( C_memfind(haystack, haystack_length, needle, length) != NULL ) break;
+			}
+			bench_end(&measure, repeat, (uint64_t)repeat * haystack_length);
+		}
+		if ( bench_wanted("C_memFind") )
+		{
+			bench_begin(&measure, "C_memFind", param);
+			for (j = 0; j < repeat; j++)
+			{
+				if ( C_memFind(haystack, haystack_length, needle, length, &position) > 0 ) break;
+			}
+			bench_end(&measure, repeat, (uint64_t)repeat * haystack_length);
+		}
+		if ( bench_wanted("C_strcasestr") )
+		{
+			bench_begin(&measure, "C_strcasestr", param);
+			for (j = 0; j < repeat; j++)
+			{
+				if ( C_strcasestr((const char*)haystack, upper_needle) != NULL ) break;
+			}
+			bench_end(&measure, repeat, (uint64_t)repeat * haystack_length);
+		}
+	}
+	free(haystack);
+}
+
+static void bench_tolower(void)
+{
+	static const unsigned int lengths[] = { 64, 4096, 1024 * 1024 };
+	const uint64_t bytes_per_length = 64 * 1024 * 1024; // same work for every length
+	benchMeasure_T measure;
+	char * text;
+	char param[64];
+	uint64_t repeat;
+	uint64_t j;
+	unsigned int i;
+	unsigned int k;
+
+	if ( bench_wanted("C_Tolower") == 0 )
+	{
+		return;
+	}
+	text = (char*)malloc(lengths[2] + 1);
+	if ( text == NULL )
+	{
+		return;
+	}
+	for (k = 0; k < lengths[2]; k++)
+	{
+		text[k] = 'A' + (char)(k % 26);
+	}
+	for (i = 0; i < sizeof(lengths)/sizeof(lengths[0]); i++)
+	{
+		repeat = bytes_per_length / lengths[i];
+		snprintf(param, sizeof(param), "length=%u", lengths[i]);
+		bench_begin(&measure, "C_Tolower", param);
+		for (j = 0; j < repeat; j++)
+		{
+			// mixed case again each time so every byte is mapped
+			for (k = 0; k < lengths[i]; k += 64)
+			{
+				text[k] = 'A' + (char)(j % 26);
+			}
+			text[lengths[i]] = '\0';
+			C_Tolower(text);
+		}
+		bench_end(&measure, repeat, repeat * lengths[i]);
+	}
+	free(text);
+}
+
+static void bench_random(void)
+{
+	static const int lengths[] = { 16, 64 };
+	const unsigned int repeat = 100000;
+	benchMeasure_T measure;
+	char token[128];
+	char param[64];
+	unsigned int i;
+	unsigned int j;
+
+	if ( bench_wanted("C_Random_alpha") == 0 )
+	{
+		return;
+	}
+	for (i = 0; i < sizeof(lengths)/sizeof(lengths[0]); i++)
+	{
+		snprintf(param, sizeof(param), "length=%d", lengths[i]);
+		bench_begin(&measure, "C_Random_alpha", param);
+		for (j = 0; j < repeat; j++)
+		{
+			C_Random_alpha(lengths[i], token, sizeof(token));
+		}
+		bench_end(&measure, repeat, (uint64_t)repeat * lengths[i]);
+	}
+}
+
+static void bench_hex(void)
+{
+	static const unsigned int lengths[] = { 6, 4096 };
+	const unsigned int total = 64 * 1024 * 1024; // bytes per case
+	benchMeasure_T measure;
+	unsigned char data[4096];
+	unsigned char back[4096];
+	char text[2 * 4096 + 1];
+	char param[64];
+	unsigned int repeat;
+	unsigned int i;
+	unsigned int j;
+
+	if ( bench_wanted("C_hex") == 0 )
+	{
+		return;
+	}
+	C_RandomFill(data, sizeof(data));
+
+	for (i = 0; i < sizeof(lengths)/sizeof(lengths[0]); i++)
+	{
+		repeat = total / lengths[i];
+		snprintf(param, sizeof(param), "bytes=%u", lengths[i]);
+
+		bench_begin(&measure, "C_hexEncode", param);
+		for (j = 0; j < repeat; j++)
+		{
+			C_hexEncode(data, lengths[i], text, sizeof(text), TOOLBOX_HEX_LOWERCASE);
+		}
+		bench_end(&measure, repeat, (uint64_t)repeat * lengths[i]);
+
+		bench_begin(&measure, "C_hexDecode", param);
+		for (j = 0; j < repeat; j++)
+		{
+			C_hexDecode(text, 2 * lengths[i], back, sizeof(back));
+		}
+		bench_end(&measure, repeat, (uint64_t)repeat * lengths[i]);
+	}
+
+	// ifstatus MAC address formatting
+	repeat = total / 6;
+	bench_begin(&measure, "C_hexEncodeSeparated", "mac");
+	for (j = 0; j < repeat; j++)
+	{
+		C_hexEncodeSeparated(data + (j & 63), 6, ':', text, sizeof(text), TOOLBOX_HEX_LOWERCASE);
+	}
+	bench_end(&measure, repeat, (uint64_t)repeat * 6);
+}
+
+// interface counters: mostly 6 to 12 digits
+static void bench_numeric(void)
+{
+	const unsigned int count = 4096;
+	const unsigned int repeat = 500;
+	benchMeasure_T measure;
+	uint64_t * values;
+	char * texts;
+	uint64_t parsed;
+	uint64_t sum = 0;
+	uint64_t bytes = 0;
+	size_t consumed;
+	unsigned int i;
+	unsigned int j;
+
+	if ( bench_wanted("C_u64toa") == 0 && bench_wanted("C_parseU64") == 0 )
+	{
+		return;
+	}
+	values = (uint64_t*)malloc(count * sizeof(uint64_t));
+	texts = (char*)malloc(count * TOOLBOX_NUMERIC_MAX_DIGITS);
+	if ( values == NULL || texts == NULL )
+	{
+		free(values);
+		free(texts);
+		return;
+	}
+	for (i = 0; i < count; i++)
+	{
+		values[i] = C_RandomU64() >> (24 + C_RandomUniform(24));
+		bytes += C_u64toa(values[i], texts + i * TOOLBOX_NUMERIC_MAX_DIGITS, TOOLBOX_NUMERIC_MAX_DIGITS);
+	}
+
+	bench_begin(&measure, "C_u64toa", "counters");
+	for (j = 0; j < repeat; j++)
+	{
+		for (i = 0; i < count; i++)
+		{
+			C_u64toa(values[i], texts + i * TOOLBOX_NUMERIC_MAX_DIGITS, TOOLBOX_NUMERIC_MAX_DIGITS);
+		}
+	}
+	bench_end(&measure, (uint64_t)repeat * count, repeat * bytes);
+
+	bench_begin(&measure, "C_u64toa", "snprintf");
+	for (j = 0; j < repeat; j++)
+	{
+		for (i = 0; i < count; i++)
+		{
+			snprintf(texts + i * TOOLBOX_NUMERIC_MAX_DIGITS, TOOLBOX_NUMERIC_MAX_DIGITS, "%llu", (unsigned long long)values[i]);
+		}
+	}
+	bench_end(&measure, (uint64_t)repeat * count, repeat * bytes);
+
+	bench_begin(&measure, "C_parseU64", "counters");
+	for (j = 0; j < repeat; j++)
+	{
+		for (i = 0; i < count; i++)
+		{
+			C_parseU64(texts + i * TOOLBOX_NUMERIC_MAX_DIGITS, TOOLBOX_NUMERIC_MAX_DIGITS, &parsed, &consumed);
+			sum += parsed;
+		}
+	}
+	bench_end(&measure, (uint64_t)repeat * count, repeat * bytes);
+
+	bench_begin(&measure, "C_parseU64", "strtoull");
+	for (j = 0; j < repeat; j++)
+	{
+		for (i = 0; i < count; i++)
+		{
+			sum += strtoull(texts + i * TOOLBOX_NUMERIC_MAX_DIGITS, NULL, 10);
+		}
+	}
+	bench_end(&measure, (uint64_t)repeat * count, repeat * bytes);
+
+	if ( sum == 1 )
+	{
+		printf("# %llu\n", (unsigned long long)sum); // keeps the loops
+	}
+	free(values);
+	free(texts);
+}
+
+// log lines: about 1000 per second share the cached prefix
+static void bench_date(void)
+{
+	const unsigned int repeat = 2000000;
+	benchMeasure_T measure;
+	char text[TOOLBOX_DATE_STRING_SIZE];
+	struct tm broken;
+	time_t when;
+	unsigned int j;
+
+	if ( bench_wanted("C_formatDate") == 0 )
+	{
+		return;
+	}
+
+	bench_begin(&measure, "C_formatDate", "usec");
+	for (j = 0; j < repeat; j++)
+	{
+		C_formatDate(1792400000 + j / 1000, (j % 1000) * 1000000, 6, TOOLBOX_DATE_LOCAL, text, sizeof(text));
+	}
+	bench_end(&measure, repeat, (uint64_t)repeat * 26);
+
+	bench_begin(&measure, "C_formatDate", "localtime_r+strftime");
+	for (j = 0; j < repeat; j++)
+	{
+		when = (time_t)(1792400000 + j / 1000);
+		localtime_r(&when, &broken);
+		strftime(text, sizeof(text), "%Y-%m-%d %H:%M:%S", &broken);
+	}
+	bench_end(&measure, repeat, (uint64_t)repeat * 19);
+
+	bench_begin(&measure, "C_Timestring", "now");
+	for (j = 0; j < repeat; j++)
+	{
+		C_Timestring(text, sizeof(text));
+	}
+	bench_end(&measure, repeat, (uint64_t)repeat * 23);
+}
+
+// config payload: one entity every 64 bytes
+static void bench_xmlEntities(void)
+{
+	static const char * const entities[] = { "&amp;", "&lt;", "&quot;", "&#233;", "&#x263A;" };
+	const size_t text_length = 1024 * 1024;
+	const unsigned int repeat = 50;
+	benchMeasure_T measure;
+	char * source;
+	char * text;
+	size_t length = 0;
+	size_t decoded;
+	unsigned int j;
+
+	if ( bench_wanted("C_xmlDecodeEntities") == 0 )
+	{
+		return;
+	}
+	source = (char*)malloc(text_length);
+	text = (char*)malloc(text_length);
+	if ( source == NULL || text == NULL )
+	{
+		free(source);
+		free(text);
+		return;
+	}
+	while ( length + 64 <= text_length )
+	{
+		const char * entity = entities[(length / 64) % 5];
+		memset(source + length, 'a' + (length / 64) % 26, 64);
+		memcpy(source + length + 30, entity, strlen(entity));
+		length += 64;
+	}
+
+	bench_begin(&measure, "C_xmlDecodeEntities", "1MB");
+	for (j = 0; j < repeat; j++)
+	{
+		memcpy(text, source, length);
+		C_xmlDecodeEntities(text, length, &decoded);
+	}
+	bench_end(&measure, repeat, (uint64_t)repeat * length);
+
+	free(source);
+	free(text);
+}
+
+static void bench_utf8(void)
+{
+	static const char * const kinds[] = { "ascii", "mixed" };
+	const unsigned int text_length = 64 * 1024;
+	const unsigned int repeat = 200;
+	benchMeasure_T measure;
+	char * text;
+	char * back;
+	wchar_t * wide;
+	unsigned int wide_size = 0;
+	unsigned int i;
+	unsigned int j;
+	unsigned int k;
+
+	if ( bench_wanted("TOOLBOX_utf") == 0 )
+	{
+		return;
+	}
+
+	text = (char*)malloc(text_length + 1);
+	back = (char*)malloc(text_length + 1);
+	wide = (wchar_t*)malloc((text_length + 1) * sizeof(wchar_t));
+	if ( text == NULL || back == NULL || wide == NULL )
+	{
+		free(text);
+		free(back);
+		free(wide);
+		return;
+	}
+	wide_size = (text_length + 1) * sizeof(wchar_t);
+
+	for (k = 0; k < 2; k++)
+	{
+		// mixed: file names with an accented letter every 32 bytes
+		for (i = 0; i < text_length; i++)
+		{
+			text[i] = 'a' + i % 26;
+			if ( k == 1 && i % 32 == 30 && i + 1 < text_length )
+			{
+				text[i++] = (char)0xC3;
+				text[i] = (char)0xA9;
+			}
+		}
+		text[text_length] = '\0';
+
+		bench_begin(&measure, "TOOLBOX_utf8ToWide", kinds[k]);
+		for (j = 0; j < repeat; j++)
+		{
+			TOOLBOX_utf8ToWide(text, wide, wide_size);
+		}
+		bench_end(&measure, repeat, (uint64_t)repeat * text_length);
+
+		bench_begin(&measure, "TOOLBOX_utf16ToUtf8", kinds[k]);
+		for (j = 0; j < repeat; j++)
+		{
+			TOOLBOX_utf16ToUtf8(wide, back, text_length + 1);
+		}
+		bench_end(&measure, repeat, (uint64_t)repeat * text_length);
+
+		bench_begin(&measure, "TOOLBOX_utf8strlen", kinds[k]);
+		for (j = 0; j < repeat; j++)
+		{
+			TOOLBOX_utf8strlen(text, -1);
+		}
+		bench_end(&measure, repeat, (uint64_t)repeat * text_length);
+	}
+	free(text);
+	free(back);
+	free(wide);
+}
+
+static void bench_textFileReader(void)
+{
+	static const unsigned int line_lengths[] = { 16, 256, 4096 };
+	const unsigned int file_size = 4 * 1024 * 1024;
+	benchMeasure_T measure;
+	textFileReader reader;
+	char filename[320];
+	char param[64];
+	char * line;
+	char * buffer = NULL;
+	unsigned int buffersize = 0;
+	unsigned int read_length;
+	unsigned int written;
+	unsigned int length;
+	uint64_t lines;
+	uint64_t bytes;
+	FILE * file;
+	unsigned int i;
+	uint32_t seed = 6789;
+
+	if ( bench_wanted("TextFileReader_GetLine") == 0 )
+	{
+		return;
+	}
+
+	line = (char*)malloc(4096 * 2 + 2);
+	if ( line == NULL )
+	{
+		return;
+	}
+	for (i = 0; i < sizeof(line_lengths)/sizeof(line_lengths[0]); i++)
+	{
+		// lengths vary from half to one and a half times the average, one line in four ends with \r\n
+		snprintf(filename, sizeof(filename), "%s/lines-%u.txt", g_bench_directory, line_lengths[i]);
+		file = fopen(filename, "wb");
+		if ( file == NULL )
+		{
+			break;
+		}
+		written = 0;
+		while ( written < file_size )
+		{
+			seed = seed * 1103515245 + 12345;
+			length = line_lengths[i] / 2 + (seed >> 8) % (line_lengths[i] + 1);
+			memset(line, 'a' + (seed >> 24) % 26, length);
+			if ( (seed >> 4) % 4 == 0 )
+			{
+				line[length++] = '\r';
+			}
+			line[length++] = '\n';
+			fwrite(line, 1, length, file);
+			written += length;
+		}
+		fclose(file);
+
+		if ( TextFileReader_Constructor(&reader, filename) <= 0 )
+		{
+			break;
+		}
+		snprintf(param, sizeof(param), "line=%u", line_lengths[i]);
+		lines = 0;
+		bytes = 0;
+		bench_begin(&measure, "TextFileReader_GetLine", param);
+		while ( TextFileReader_GetLine(&reader, &buffer, &buffersize, &read_length, 1) > 0 )
+		{
+			lines++;
+			bytes += read_length;
+		}
+		bench_end(&measure, lines, bytes);
+		TextFileReader_Destructor(&reader);
+		unlink(filename);
+	}
+	free(buffer);
+	free(line);
+}
+
+static void bench_tree(void)
+{
+	static const unsigned int counts[] = { 1000, 10000, 100000, 1000000 };
+	benchMeasure_T measure;
+	benchMeasure_T * previous = NULL;
+	genericTree_T tree;
+	char name[32];
+	char param[64];
+	unsigned int i;
+	unsigned int j;
+
+	if ( bench_wanted("genericTree_Insert") == 0 )
+	{
+		return;
+	}
+	for (i = 0; i < sizeof(counts)/sizeof(counts[0]); i++)
+	{
+		if ( i > 0 && bench_tooSlow(previous, counts[i-1], counts[i], 2) )
+		{
+			break;
+		}
+		if ( genericTree_Constructor(&tree) <= 0 )
+		{
+			break;
+		}
+		snprintf(param, sizeof(param), "siblings=%u", counts[i]);
+		bench_begin(&measure, "genericTree_Insert", param);
+		for (j = 0; j < counts[i]; j++)
+		{
+			// odd multiplier is a permutation of 32-bit values, names are unique and in random order
+			snprintf(name, sizeof(name), "item%08x", j * 2654435761U);
+			genericTree_Insert(&tree, &tree.top, name, 0, NULL, NULL);
+		}
+		bench_end(&measure, counts[i], 0);
+		previous = &measure;
+		genericTree_Destructor(&tree);
+	}
+}
+
+// same names as bench_tree, in one batch. sorted=1 is the readdir-sorted case, no qsort
+static void bench_treeBulk(void)
+{
+	static const unsigned int counts[] = { 1000, 10000, 100000, 1000000 };
+	benchMeasure_T measure;
+	genericTree_T tree;
+	char * buffer;
+	const char ** names;
+	char param[64];
+	unsigned int i;
+	unsigned int j;
+	int sorted;
+
+	if ( bench_wanted("genericTree_InsertBulk") == 0 )
+	{
+		return;
+	}
+	buffer = (char*)malloc((size_t)counts[3] * 16);
+	names = (const char **)malloc((size_t)counts[3] * sizeof(char*));
+	if ( buffer == NULL || names == NULL )
+	{
+		free(buffer);
+		free(names);
+		return;
+	}
+	for (i = 0; i < sizeof(counts)/sizeof(counts[0]); i++)
+	{
+		for (sorted = 0; sorted <= 1; sorted++)
+		{
+			for (j = 0; j < counts[i]; j++)
+			{
+				snprintf(buffer + (size_t)j * 16, 16, "item%08x", sorted ? j : j * 2654435761U);
+				names[j] = buffer + (size_t)j * 16;
+			}
+			if ( genericTree_Constructor(&tree) <= 0 )
+			{
+				break;
+			}
+			snprintf(param, sizeof(param), "siblings=%u,sorted=%d", counts[i], sorted);
+			bench_begin(&measure, "genericTree_InsertBulk", param);
+			genericTree_InsertBulk(&tree, NULL, names, NULL, NULL, (int)counts[i], NULL);
+			bench_end(&measure, counts[i], 0);
+			genericTree_Destructor(&tree);
+		}
+	}
+	free(buffer);
+	free(names);
+}
+
+static int bench_treeVisitor(treeItem_T * item, int depth, void * opaque)
+{
+	*(uint64_t*)opaque += item->unique_id + (uint64_t)depth;
+	return 1;
+}
+
+// file inventory shape: 1000 directories of 100 files
+static void bench_treeWalk(void)
+{
+	static const char * const orders[] = { "pre", "post", "breadth" };
+	const unsigned int repeat = 20;
+	benchMeasure_T measure;
+	genericTree_T tree;
+	treeItem_T * directory;
+	genericTreeCursor_T cursor;
+	treeItem_T * item;
+	uint64_t sum = 0;
+	char name[32];
+	unsigned int i;
+	unsigned int j;
+	int order;
+
+	if ( bench_wanted("genericTree_Visit") == 0 )
+	{
+		return;
+	}
+	if ( genericTree_Constructor(&tree) <= 0 )
+	{
+		return;
+	}
+	for (i = 0; i < 1000; i++)
+	{
+		snprintf(name, sizeof(name), "dir%08x", i * 2654435761U);
+		if ( genericTree_Insert(&tree, &tree.top, name, 0, NULL, &directory) <= 0 )
+		{
+			continue;
+		}
+		for (j = 0; j < 100; j++)
+		{
+			snprintf(name, sizeof(name), "file%08x", j * 2654435761U);
+			genericTree_Insert(&tree, directory, name, 0, NULL, NULL);
+		}
+	}
+
+	for (order = TREE_ORDER_PRE; order <= TREE_ORDER_BREADTH; order++)
+	{
+		bench_begin(&measure, "genericTree_Visit", orders[order]);
+		for (j = 0; j < repeat; j++)
+		{
+			genericTree_Visit(&tree, NULL, order, bench_treeVisitor, &sum);
+		}
+		bench_end(&measure, (uint64_t)repeat * tree.itemAmount, 0);
+	}
+
+	bench_begin(&measure, "genericTreeCursor_Next", "pre");
+	for (j = 0; j < repeat; j++)
+	{
+		genericTreeCursor_Constructor(&cursor, &tree, NULL, TREE_ORDER_PRE);
+		while ( (item = genericTreeCursor_Next(&cursor)) != NULL )
+		{
+			sum += item->unique_id;
+		}
+	}
+	bench_end(&measure, (uint64_t)repeat * tree.itemAmount, 0);
+
+	if ( sum == 1 )
+	{
+		printf("# %llu\n", (unsigned long long)sum);
+	}
+	genericTree_Destructor(&tree);
+}
+
+static int bench_traverseCallback(const char * name, const fileEntry_T * entry, void * opaque1, void * opaque2)
+{
+	uint64_t * visited = (uint64_t *)opaque1;
+	(*visited)++;
+	if ( entry->isDirectory )
+	{
+		traverseDir(name, bench_traverseCallback, opaque1, opaque2);
+	}
+	return 1;
+}
+
+static void bench_traverseDir(void)
+{
+	const unsigned int directories = 20;
+	const unsigned int files = 100; // per directory
+	const unsigned int repeat = 20;
+	benchMeasure_T measure;
+	char path[320];
+	char param[64];
+	uint64_t visited = 0;
+	unsigned int i;
+	unsigned int j;
+	FILE * file;
+
+	if ( bench_wanted("traverseDir") == 0 )
+	{
+		return;
+	}
+
+	snprintf(path, sizeof(path), "%s/tree", g_bench_directory);
+	mkdir(path, 0700);
+	for (i = 0; i < directories; i++)
+	{
+		snprintf(path, sizeof(path), "%s/tree/dir%u", g_bench_directory, i);
+		mkdir(path, 0700);
+		for (j = 0; j < files; j++)
+		{
+			snprintf(path, sizeof(path), "%s/tree/dir%u/file%u", g_bench_directory, i, j);
+			file = fopen(path, "wb");
+			if ( file ) fclose(file);
+		}
+	}
+
+	snprintf(path, sizeof(path), "%s/tree", g_bench_directory);
+	snprintf(param, sizeof(param), "entries=%u", directories * (files + 1));
+	bench_begin(&measure, "traverseDir", param);
+	for (i = 0; i < repeat; i++)
+	{
+		traverseDir(path, bench_traverseCallback, &visited, NULL);
+	}
+	bench_end(&measure, visited, 0);
+
+	for (i = 0; i < directories; i++)
+	{
+		for (j = 0; j < files; j++)
+		{
+			snprintf(path, sizeof(path), "%s/tree/dir%u/file%u", g_bench_directory, i, j);
+			unlink(path);
+		}
+		snprintf(path, sizeof(path), "%s/tree/dir%u", g_bench_directory, i);
+		rmdir(path);
+	}
+	snprintf(path, sizeof(path), "%s/tree", g_bench_directory);
+	rmdir(path);
+}
+
+static void bench_system(void)
+{
+	const unsigned int repeat = 50;
+	benchMeasure_T measure;
+	char output[256];
+	int status;
+	unsigned int i;
+
+	if ( bench_wanted("C_System2") == 0 )
+	{
+		return;
+	}
+	bench_begin(&measure, "C_System2", "true");
+	for (i = 0; i < repeat; i++)
+	{
+		C_System2("true", output, sizeof(output), &status);
+	}
+	bench_end(&measure, repeat, 0);
+}
+
+int main(int argc, char *argv[])
+{
+	if (argc > 1)
+	{
+		g_bench_filter = argv[1];
+	}
+
+	snprintf(g_bench_directory, sizeof(g_bench_directory), "%s/toolbox-bench-XXXXXX", tmpPath);
+	if (mkdtemp(g_bench_directory) == NULL)
+	{
+		printf("# cannot create %s\n", g_bench_directory);
+		return 1;
+	}
+
+#if defined(__OPTIMIZE__)
+	printf("# toolbox-bench gcc %s optimized\n", __VERSION__);
+#else
+	printf("# toolbox-bench gcc %s not optimized\n", __VERSION__);
+#endif
+	printf("# name param ops ns_per_op allocs_per_op alloc_bytes_per_op mb_per_s\n");
+
+	bench_append();
+	bench_search();
+	bench_tolower();
+	bench_random();
+	bench_hex();
+	bench_numeric();
+	bench_date();
+	bench_xmlEntities();
+	bench_utf8();
+	bench_textFileReader();
+	bench_tree();
+	bench_treeBulk();
+	bench_treeWalk();
+	bench_traverseDir();
+	bench_system();
+
+	rmdir(g_bench_directory);
+	return 0;
+}
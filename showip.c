@@ -6,6 +6,11 @@
 Will display eth0 IP in lxpanel widget, if eth0 is not connected will fallback to wlan0. 
 If both are unconnected, will display blank.
 
+=SETTINGS (plugin section of the panel configuration file)
+
+ShowRates=1  also display current RX/TX rates of the displayed interface
+Period=4     seconds between refreshes (1 to 3600)
+
 =BUILD INSTRUCTIONS
 
 $> make
@@ -34,6 +39,11 @@ then right click on top panel and add "showip"
 #include <ifaddrs.h>
 #include <netinet/in.h> 
 #include <arpa/inet.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
 
 #include "toolbox.h"
 
@@ -41,26 +51,155 @@ then right click on top panel and add "showip"
 static int iInstanceCount = 0;
 
 
+// what every instance displays, found once per refresh by the worker thread
+typedef struct
+{
+   char ip[256];
+   char which_interface[256];
+   int want_rates; // set by the main loop before the worker starts
+   int have_rates;
+   double rx_bits_per_second;
+   double tx_bits_per_second;
+} ShowIpAddress;
+
 typedef struct 
 {
 	LXPanel *panel;
 	gint iMyId;
 	GtkWidget *gLabel;
-	unsigned int timer;
+	int show_rates; // "ShowRates" setting
+	int period; // "Period" setting, seconds
 } ShowIp;
 
+// one per lxpanel process, set up by showip_init(), shared by every ShowIp instance
+typedef struct
+{
+	GSList *subscribers; // ShowIp *
+	unsigned int timer;
+	int timer_period; // smallest Period of the subscribers
+	int netlink_fd; // address and link change notifications
+	GIOChannel *netlink_channel;
+	unsigned int netlink_watch;
+	ShowIpAddress last;
+	// discovery runs off the main loop on one long-lived thread, one at a time
+	GThreadPool *worker;
+	int worker_busy; // set from the push until monitor_discovered runs
+	int refresh_pending; // a refresh was asked while the worker was busy
+	ShowIpAddress result; // owned by the worker while it runs
+	interfaceRates_T rates; // only used by the worker
+} ShowIpMonitor;
+
+#define SHOWIP_DEFAULT_PERIOD 4
+
+static ShowIpMonitor g_monitor = { NULL, 0, 0, -1, NULL, 0 };
+
+// published by `standalone --daemon` when it runs, see toolbox-ifstatus.h
+// used by the worker thread, and by showip_finalize() once no worker runs
+static ifStatusReader_T g_status_reader;
+
+// same choice as the getifaddrs walk in update_display: eth0 IPv4,
+// else the last other IPv4 except lo, else the first IPv6 except lo.
+// Returns 0 if no publisher is running.
+static int pick_from_status(char * ip, size_t ip_size, char * which_interface, size_t interface_size)
+{
+   ifStatusSnapshot_T snapshot;
+   const ifStatusInterface_T * entry;
+   const ifStatusAddress_T * chosen = NULL;
+   const char * chosen_interface = NULL;
+   uint32_t i;
+   uint32_t j;
+
+   if (g_status_reader.segment == NULL && ifStatusReader_Open(&g_status_reader, NULL) <= 0)
+   {
+      return 0;
+   }
+   if (ifStatusReader_Read(&g_status_reader, &snapshot) <= 0)
+   {
+      ifStatusReader_Close(&g_status_reader); // publisher stopped, reopen on a later tick
+      return 0;
+   }
+
+   for (i = 0; i < snapshot.count; i++)
+   {
+      entry = &snapshot.interfaces[i];
+      if (strcmp(entry->name, "lo") == 0)
+      {
+         continue;
+      }
+      for (j = 0; j < entry->address_count; j++)
+      {
+         if (entry->addresses[j].family == TOOLBOX_IFSTATUS_IPV4)
+         {
+            chosen = &entry->addresses[j];
+            chosen_interface = entry->name;
+         }
+      }
+      if (chosen_interface == entry->name && strcmp(entry->name, "eth0") == 0)
+      {
+         break;
+      }
+   }
+
+   for (i = 0; chosen == NULL && i < snapshot.count; i++)
+   {
+      entry = &snapshot.interfaces[i];
+      for (j = 0; j < entry->address_count && strcmp(entry->name, "lo") != 0; j++)
+      {
+         if (entry->addresses[j].family == TOOLBOX_IFSTATUS_IPV6)
+         {
+            chosen = &entry->addresses[j];
+            chosen_interface = entry->name;
+            break;
+         }
+      }
+   }
+
+   if (chosen)
+   {
+      snprintf(ip, ip_size, "%s", chosen->address);
+      snprintf(which_interface, interface_size, "%s", chosen_interface);
+   }
+   return 1;
+}
 
-static void update_display(ShowIp *pPlugin)
+// interface counters are kept open between refreshes, worker thread only
+static void sample_rates(ShowIpAddress *found)
 {
-   GdkColor color;
+   found->have_rates = 0;
+   if (found->which_interface[0] == '\0')
+   {
+      return;
+   }
 
-   char ip[256];
-   char which_interface[256] = "";
+   if (g_monitor.rates.rx_fd < 0 || strcmp(g_monitor.rates.interface_name, found->which_interface) != 0)
+   {
+      interfaceRates_Destructor(&g_monitor.rates);
+      interfaceRates_Constructor(&g_monitor.rates, found->which_interface, 0);
+   }
+
+   if (interfaceRates_Sample(&g_monitor.rates) > 0) // not on first sample or if interface is gone
+   {
+      found->rx_bits_per_second = g_monitor.rates.rx_bits_per_second;
+      found->tx_bits_per_second = g_monitor.rates.tx_bits_per_second;
+      found->have_rates = 1;
+   }
+}
+
+static void discover_address(ShowIpAddress *found)
+{
    struct ifaddrs * ifAddrStruct=NULL;
    struct ifaddrs * ifa=NULL;
    void * tmpAddrPtr=NULL;
+   TOOLBOX_TIMING_SCOPE("showip discover_address");
 
-   getifaddrs(&ifAddrStruct);
+   found->ip[0] = '\0';
+   found->which_interface[0] = '\0';
+
+   // the walks below find nothing if the published status was used
+   if (pick_from_status(found->ip, sizeof(found->ip), found->which_interface, sizeof(found->which_interface)) == 0)
+   {
+      getifaddrs(&ifAddrStruct);
+   }
 
    // get eth0 first
    for (ifa = ifAddrStruct; ifa != NULL; ifa = ifa->ifa_next) 
@@ -75,11 +214,11 @@ static void update_display(ShowIp *pPlugin)
          tmpAddrPtr=&((struct sockaddr_in *)ifa->ifa_addr)->sin_addr;
          char addressBuffer[INET_ADDRSTRLEN];
          inet_ntop(AF_INET, tmpAddrPtr, addressBuffer, INET_ADDRSTRLEN);
-         printf("%s IP Address %s\n", ifa->ifa_name, addressBuffer);
+         TOOLBOX_LOG(TOOLBOX_LOG_DEBUG, "%s IP Address %s\n", ifa->ifa_name, addressBuffer);
          if (strcmp(ifa->ifa_name, "lo") != 0)
          {
-            strncpy(ip, addressBuffer, sizeof(ip)-1);
-            strcpy(which_interface, ifa->ifa_name);
+            strncpy(found->ip, addressBuffer, sizeof(found->ip)-1);
+            strcpy(found->which_interface, ifa->ifa_name);
 	 }
 	 
 	 if (strcmp(ifa->ifa_name, "eth0") == 0)
@@ -90,7 +229,7 @@ static void update_display(ShowIp *pPlugin)
    }
    
    // get eth0 first
-   if (ip[0] == '\0') for (ifa = ifAddrStruct; ifa != NULL; ifa = ifa->ifa_next) 
+   if (found->ip[0] == '\0') for (ifa = ifAddrStruct; ifa != NULL; ifa = ifa->ifa_next) 
    {
       if (!ifa->ifa_addr) 
       {
@@ -101,17 +240,17 @@ static void update_display(ShowIp *pPlugin)
          tmpAddrPtr=&((struct sockaddr_in *)ifa->ifa_addr)->sin_addr;
          char addressBuffer[INET_ADDRSTRLEN];
          inet_ntop(AF_INET, tmpAddrPtr, addressBuffer, INET_ADDRSTRLEN);
-         printf("%s IP Address %s\n", ifa->ifa_name, addressBuffer);
+         TOOLBOX_LOG(TOOLBOX_LOG_DEBUG, "%s IP Address %s\n", ifa->ifa_name, addressBuffer);
          if (ifa->ifa_name[0] == 'w')
          {
-            strncpy(ip, addressBuffer, sizeof(ip)-1); // get wireless lans
-            strcpy(which_interface, ifa->ifa_name);
+            strncpy(found->ip, addressBuffer, sizeof(found->ip)-1); // get wireless lans
+            strcpy(found->which_interface, ifa->ifa_name);
 	 }
       }
    }
     
    // loop ipv6 if we couldnt find ipv4 eth0
-   if (ip[0] == '\0') for (ifa = ifAddrStruct; ifa != NULL; ifa = ifa->ifa_next) 
+   if (found->ip[0] == '\0') for (ifa = ifAddrStruct; ifa != NULL; ifa = ifa->ifa_next) 
    {
       if (!ifa->ifa_addr) 
       {
@@ -123,11 +262,11 @@ static void update_display(ShowIp *pPlugin)
          tmpAddrPtr=&((struct sockaddr_in6 *)ifa->ifa_addr)->sin6_addr;
          char addressBuffer[INET6_ADDRSTRLEN];
          inet_ntop(AF_INET6, tmpAddrPtr, addressBuffer, INET6_ADDRSTRLEN);
-         printf("%s IP Address %s\n", ifa->ifa_name, addressBuffer); 
+         TOOLBOX_LOG(TOOLBOX_LOG_DEBUG, "%s IP Address %s\n", ifa->ifa_name, addressBuffer); 
          if (strcmp(ifa->ifa_name, "lo") != 0)
          {
-            strncpy(ip, addressBuffer, sizeof(ip)-1);
-            strcpy(which_interface, ifa->ifa_name);
+            strncpy(found->ip, addressBuffer, sizeof(found->ip)-1);
+            strcpy(found->which_interface, ifa->ifa_name);
 	    break;
          }
       } 
@@ -135,36 +274,283 @@ static void update_display(ShowIp *pPlugin)
     
    if (ifAddrStruct!=NULL) freeifaddrs(ifAddrStruct);
     
-   printf("ip(%s)\n",ip);
+   TOOLBOX_LOG(TOOLBOX_LOG_DEBUG, "ip(%s)\n", found->ip);
+}
 
-   if (ip[0] == '\0')
+static void update_display(ShowIp *pPlugin, const ShowIpAddress *found)
+{
+   GdkColor color;
+   char label[256];
+   TOOLBOX_TIMING_SCOPE("showip update_display");
+
+   if (found->ip[0] == '\0')
+   {
+      strcpy(label, "No IP found");	
+   }
+   else if (pPlugin->show_rates && found->have_rates)
    {
-      strcpy(ip, "No IP found");	
+      char rx[32];
+      char tx[32];
+      C_FormatBitRate(found->rx_bits_per_second, rx, sizeof(rx));
+      C_FormatBitRate(found->tx_bits_per_second, tx, sizeof(tx));
+      snprintf(label, sizeof(label), "%s \xE2\x86\x93%s \xE2\x86\x91%s", found->ip, rx, tx);
+   }
+   else
+   {
+      strcpy(label, found->ip);
    }
    
-   //lxpanel_draw_label_text(pPlugin->panel, pPlugin->gLabel, ip, TRUE, 2, TRUE);
+   //lxpanel_draw_label_text(pPlugin->panel, pPlugin->gLabel, label, TRUE, 2, TRUE);
    gdk_color_parse("#FF80FF", &color);
    color.pixel = 1;
    color.green = 255;
    color.blue = 155;
    color.red = 100;
-   lxpanel_draw_label_text_with_color(pPlugin->panel, pPlugin->gLabel, ip, TRUE, 1.3, &color);
-   gtk_widget_set_tooltip_text(pPlugin->gLabel, which_interface);
+   lxpanel_draw_label_text_with_color(pPlugin->panel, pPlugin->gLabel, label, TRUE, 1.3, &color);
+   gtk_widget_set_tooltip_text(pPlugin->gLabel, found->which_interface);
+}
+
+static void monitor_refresh(void);
+
+// main loop, posted by the worker once its result is ready
+static gboolean monitor_discovered(gpointer user_data)
+{
+   GSList *item;
+   (void)user_data;
+
+   g_monitor.worker_busy = 0; // posting this was the last step of the worker
+   g_monitor.last = g_monitor.result;
+
+   // one discovery, fanned out to every instance
+   for (item = g_monitor.subscribers; item != NULL; item = item->next)
+   {
+      update_display((ShowIp *)item->data, &g_monitor.last);
+   }
+
+   if (g_monitor.refresh_pending)
+   {
+      g_monitor.refresh_pending = 0;
+      monitor_refresh();
+   }
+   return FALSE;
+}
+
+static void monitor_worker(gpointer data, gpointer user_data)
+{
+   (void)data;
+   (void)user_data;
+
+   discover_address(&g_monitor.result);
+   if (g_monitor.result.want_rates)
+   {
+      sample_rates(&g_monitor.result);
+   }
+   g_idle_add(monitor_discovered, &g_monitor.result);
+}
+
+// starts a discovery, or remembers to start one more when the running one is done
+static void monitor_refresh(void)
+{
+   GSList *item;
+
+   if (g_monitor.worker_busy)
+   {
+      g_monitor.refresh_pending = 1; // many requests during one discovery give one more
+      return;
+   }
+
+   g_monitor.result.want_rates = 0;
+   for (item = g_monitor.subscribers; item != NULL; item = item->next)
+   {
+      if (((ShowIp *)item->data)->show_rates)
+      {
+         g_monitor.result.want_rates = 1;
+      }
+   }
+   if (g_monitor.worker == NULL)
+   {
+      // exclusive: the thread is started once and waits for the next push,
+      // no thread creation per tick and its per-thread state is reused
+      g_monitor.worker = g_thread_pool_new(monitor_worker, NULL, 1, TRUE, NULL);
+      if (g_monitor.worker == NULL)
+      {
+         return;
+      }
+   }
+   g_monitor.worker_busy = 1;
+   g_thread_pool_push(g_monitor.worker, &g_monitor.result, NULL);
 }
 
-static gboolean update_display_timeout(gpointer user_data)
+static gboolean monitor_timeout(gpointer user_data)
 {
+   (void)user_data;
    if (g_source_is_destroyed(g_main_current_source()))
       return FALSE;
-   update_display(user_data);
+   monitor_refresh();
    return TRUE; /* repeat later */
 }
 
+static gboolean monitor_netlink_event(GIOChannel *source, GIOCondition condition, gpointer user_data)
+{
+   char drain[8192];
+   ssize_t received;
+   (void)source;
+   (void)user_data;
+
+   if (condition & (G_IO_HUP | G_IO_NVAL))
+   {
+      g_monitor.netlink_watch = 0;
+      return FALSE; // the timer keeps refreshing
+   }
+
+   // a burst of events gives one refresh.
+   // G_IO_ERR is a receive buffer overrun (ENOBUFS) after a burst, events were lost:
+   // recv reports it once and clears it, keep draining, the refresh resyncs
+   for (;;)
+   {
+      received = recv(g_monitor.netlink_fd, drain, sizeof(drain), MSG_DONTWAIT);
+      if (received > 0 || (received < 0 && (errno == ENOBUFS || errno == EINTR)))
+      {
+         continue;
+      }
+      break;
+   }
+   monitor_refresh();
+   return TRUE;
+}
+
+// one timer at the smallest period asked by a subscriber, none without subscribers
+static void monitor_schedule(void)
+{
+   GSList *item;
+   int period = 0;
+
+   for (item = g_monitor.subscribers; item != NULL; item = item->next)
+   {
+      ShowIp *pPlugin = (ShowIp *)item->data;
+      if (period == 0 || pPlugin->period < period)
+      {
+         period = pPlugin->period;
+      }
+   }
+
+   if (period == g_monitor.timer_period && (g_monitor.timer != 0 || period == 0))
+   {
+      return;
+   }
+   if (g_monitor.timer)
+   {
+      g_source_remove(g_monitor.timer);
+      g_monitor.timer = 0;
+   }
+   g_monitor.timer_period = period;
+   if (period > 0)
+   {
+      g_monitor.timer = g_timeout_add_seconds(period, (GSourceFunc) monitor_timeout, NULL);
+   }
+}
+
+static void monitor_subscribe(ShowIp *pPlugin)
+{
+   int first = (g_monitor.subscribers == NULL);
+
+   g_monitor.subscribers = g_slist_prepend(g_monitor.subscribers, pPlugin);
+   monitor_schedule();
+   if (first || (pPlugin->show_rates && g_monitor.last.want_rates == 0))
+   {
+      monitor_refresh(); // label is updated when the worker is done
+   }
+   if (first == 0)
+   {
+      update_display(pPlugin, &g_monitor.last);
+   }
+}
+
+static void monitor_unsubscribe(ShowIp *pPlugin)
+{
+   g_monitor.subscribers = g_slist_remove(g_monitor.subscribers, pPlugin);
+   monitor_schedule();
+}
+
+static void showip_init(void)
+{
+   struct sockaddr_nl groups;
+
+   interfaceRates_Constructor(&g_monitor.rates, NULL, 0);
+
+   g_monitor.netlink_fd = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC | SOCK_NONBLOCK, NETLINK_ROUTE);
+   if (g_monitor.netlink_fd < 0)
+   {
+      return; // the timer alone will refresh
+   }
+
+   memset(&groups, 0, sizeof(groups));
+   groups.nl_family = AF_NETLINK;
+   groups.nl_groups = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+   if (bind(g_monitor.netlink_fd, (struct sockaddr *)&groups, sizeof(groups)) < 0)
+   {
+      close(g_monitor.netlink_fd);
+      g_monitor.netlink_fd = -1;
+      return;
+   }
+
+   g_monitor.netlink_channel = g_io_channel_unix_new(g_monitor.netlink_fd);
+   g_monitor.netlink_watch = g_io_add_watch(g_monitor.netlink_channel, G_IO_IN | G_IO_ERR | G_IO_HUP, monitor_netlink_event, NULL);
+}
+
+static void showip_finalize(void)
+{
+   if (g_monitor.worker)
+   {
+      // let a running discovery finish, then drop the result it posted
+      g_thread_pool_free(g_monitor.worker, FALSE, TRUE);
+      g_monitor.worker = NULL;
+      if (g_monitor.worker_busy)
+      {
+         g_source_remove_by_user_data(&g_monitor.result);
+         g_monitor.worker_busy = 0;
+      }
+   }
+   if (g_monitor.netlink_watch)
+   {
+      g_source_remove(g_monitor.netlink_watch);
+      g_monitor.netlink_watch = 0;
+   }
+   if (g_monitor.netlink_channel)
+   {
+      g_io_channel_unref(g_monitor.netlink_channel);
+      g_monitor.netlink_channel = NULL;
+   }
+   if (g_monitor.netlink_fd >= 0)
+   {
+      close(g_monitor.netlink_fd);
+      g_monitor.netlink_fd = -1;
+   }
+   if (g_monitor.timer)
+   {
+      g_source_remove(g_monitor.timer);
+      g_monitor.timer = 0;
+   }
+   g_slist_free(g_monitor.subscribers);
+   g_monitor.subscribers = NULL;
+   g_monitor.refresh_pending = 0;
+   interfaceRates_Destructor(&g_monitor.rates);
+   ifStatusReader_Close(&g_status_reader);
+}
+
+static void showip_destructor(gpointer user_data)
+{
+   ShowIp *pPlugin = (ShowIp *)user_data;
+
+   monitor_unsubscribe(pPlugin);
+   g_free(pPlugin);
+}
+
 GtkWidget *showip_constructor(LXPanel *panel, config_setting_t *settings)
 {
    /* panel is a pointer to the panel and
       settings is a pointer to the configuration data. */
-   (void)settings;
+   int value;
 
    // allocate our private structure instance
    ShowIp *pPlugin = g_new0(ShowIp, 1);
@@ -173,6 +559,16 @@ GtkWidget *showip_constructor(LXPanel *panel, config_setting_t *settings)
    pPlugin->iMyId = ++iInstanceCount;
    pPlugin->panel = panel;
 
+   pPlugin->period = SHOWIP_DEFAULT_PERIOD;
+   if (config_setting_lookup_int(settings, "ShowRates", &value))
+   {
+      pPlugin->show_rates = value;
+   }
+   if (config_setting_lookup_int(settings, "Period", &value) && value >= 1 && value <= 3600)
+   {
+      pPlugin->period = value;
+   }
+
    // make a label out of the ID
    char cIdBuf[20];
    cIdBuf[sizeof(cIdBuf)-1] = '\0';
@@ -181,7 +577,8 @@ GtkWidget *showip_constructor(LXPanel *panel, config_setting_t *settings)
    // create a label widget instance 
    pPlugin->gLabel = gtk_label_new(cIdBuf);
 	
-   update_display(pPlugin);
+   // displays right away, then on every refresh of the shared monitor
+   monitor_subscribe(pPlugin);
 
    // set the label to be visible
    gtk_widget_show(pPlugin->gLabel);
@@ -193,8 +590,8 @@ GtkWidget *showip_constructor(LXPanel *panel, config_setting_t *settings)
    // it is usually illegal to call gtk_widget_set_has_window() from application but for GtkEventBox it doesn't hurt
    gtk_widget_set_has_window(p, FALSE);
 
-   // bind private structure to the widget assuming it should be freed using g_free()
-   lxpanel_plugin_set_data(p, pPlugin, g_free);
+   // bind private structure to the widget, showip_destructor() unsubscribes
+   lxpanel_plugin_set_data(p, pPlugin, showip_destructor);
 
    // set border width
    gtk_container_set_border_width(GTK_CONTAINER(p), 1);
@@ -203,9 +600,7 @@ GtkWidget *showip_constructor(LXPanel *panel, config_setting_t *settings)
    gtk_container_add(GTK_CONTAINER(p), pPlugin->gLabel);
 
    // set the size we want
-   gtk_widget_set_size_request(p, 140, 25);
-	
-   pPlugin->timer = g_timeout_add_seconds(4, (GSourceFunc) update_display_timeout, (gpointer)pPlugin);
+   gtk_widget_set_size_request(p, pPlugin->show_rates ? 300 : 140, 25);
 
    return p;
 }
@@ -218,6 +613,8 @@ LXPanelPluginInit fm_module_init_lxpanel_gtk = {
    .description = "Display current IP address.",
 
    // assigning our functions to provided pointers.
+   .init = showip_init,
+   .finalize = showip_finalize,
    .new_instance = showip_constructor
 };
 
@@ -1,6 +1,8 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
+#include <signal.h>
 #include <sys/types.h>
 #include <ifaddrs.h>
 #include <netinet/in.h> 
@@ -8,6 +10,110 @@
 
 #include "toolbox.h"
 
+static volatile int g_stop = 0;
+
+static void on_signal(int signal_number)
+{
+	(void)signal_number;
+	g_stop = 1;
+}
+
+// publishes interface status in shared memory until SIGINT or SIGTERM
+static int run_daemon(unsigned int period_ms)
+{
+	int iret;
+
+	signal(SIGINT, on_signal);
+	signal(SIGTERM, on_signal);
+	toolbox_log_DumpOnSignal(SIGUSR1); // kill -USR1 writes recent log messages to stderr
+	iret = ifStatus_RunPublisher(NULL, period_ms, &g_stop);
+	if (iret <= 0)
+	{
+		printf("publisher failed, iret(%d)\n", iret);
+		return 1;
+	}
+	return 0;
+}
+
+// prints what the daemon publishes
+static int print_status(void)
+{
+	ifStatusReader_T reader;
+	ifStatusSnapshot_T snapshot;
+	const ifStatusInterface_T * entry;
+	unsigned int i;
+	unsigned int j;
+	int iret;
+
+	iret = ifStatusReader_Open(&reader, NULL);
+	if (iret <= 0)
+	{
+		printf("no status published, is standalone --daemon running? iret(%d)\n", iret);
+		return 1;
+	}
+	iret = ifStatusReader_Read(&reader, &snapshot);
+	ifStatusReader_Close(&reader);
+	if (iret < 0)
+	{
+		printf("failed to read status, iret(%d)\n", iret);
+		return 1;
+	}
+	if (iret == 0)
+	{
+		printf("warning: status is stale, publisher stopped\n");
+	}
+
+	for (i = 0; i < snapshot.count; i++)
+	{
+		entry = &snapshot.interfaces[i];
+		printf("%s: flags(0x%x) mac(%s)\n", entry->name, entry->flags, entry->mac);
+		for (j = 0; j < entry->address_count; j++)
+		{
+			printf("\tip(%s/%u)\n", entry->addresses[j].address, entry->addresses[j].prefix_length);
+		}
+		printf("\tRX_packets(%llu) RX_errors(%llu) RX_bytes(%llu)\n", (unsigned long long)entry->rx_packets, (unsigned long long)entry->rx_errors, (unsigned long long)entry->rx_bytes);
+		printf("\tTX_packets(%llu) TX_errors(%llu) TX_bytes(%llu) collisions(%llu)\n", (unsigned long long)entry->tx_packets, (unsigned long long)entry->tx_errors, (unsigned long long)entry->tx_bytes, (unsigned long long)entry->collisions);
+	}
+	return 0;
+}
+
+static int timing_callback(const char * name, const fileEntry_T * entry, void * opaque1, void * opaque2)
+{
+	genericTree_T * tree = (genericTree_T *)opaque1;
+	(void)entry;
+	(void)opaque2;
+	genericTree_Insert(tree, &tree->top, name, 0, NULL, NULL);
+	return 1;
+}
+
+// runs the instrumented paths a few times then prints their latency histograms
+static int print_timing(const char * directory)
+{
+	genericTree_T tree;
+	char ifconfig[20000];
+	char ip[256];
+	int i;
+
+	if (genericTree_Constructor(&tree) <= 0)
+	{
+		return 1;
+	}
+	for (i = 0; i < 10; i++)
+	{
+		ifconfig[0] = '\0'; // empty so ifconfig runs again through C_System2
+		C_GetNetworkInformation(ip, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, ifconfig, sizeof(ifconfig), NULL);
+		traverseDir(directory, timing_callback, &tree, NULL);
+	}
+	genericTree_Destructor(&tree);
+
+	C_TimingPrint(stdout);
+	return 0;
+}
+
+// standalone                  prints addresses
+// standalone --daemon [ms]    publishes interface status for the plugin and scripts
+// standalone --status         prints the published status
+// standalone --timing [dir]   prints latency of C_System2, traverseDir and genericTree_Insert
 int main(int argc, char *argv[])
 {
 	int iret;
@@ -23,6 +129,20 @@ int main(int argc, char *argv[])
 	char TX_bytes[256];
 	char collisions[256];
 	char ifconfig[20000] = "";
+
+	if (argc > 1 && strcmp(argv[1], "--daemon") == 0)
+	{
+		return run_daemon(argc > 2 ? (unsigned int)atoi(argv[2]) : 0);
+	}
+	if (argc > 1 && strcmp(argv[1], "--status") == 0)
+	{
+		return print_status();
+	}
+	if (argc > 1 && strcmp(argv[1], "--timing") == 0)
+	{
+		return print_timing(argc > 2 ? argv[2] : "/etc");
+	}
+
 	printf("eth0:");
 
 	struct ifaddrs * ifAddrStruct=NULL;
@@ -118,6 +118,7 @@ int TextFileReader_GetLine(textFileReader * reader, char ** buffer, unsigned int
 	int read_size;
 	int length;
 	int skipped = 0; // skipped is usally length + number of \r and \n bytes
+	TOOLBOX_TIMING_SCOPE("TextFileReader_GetLine");
 
 	if ( reader == NULL )
 	{
@@ -11,6 +11,7 @@
 
 #define C_TOOLBOX_LOGIN 0
 #define C_TOOLBOX_TIMING 1
+#define C_TOOLBOX_TIMING_INSTRUMENTATION 1 // TOOLBOX_TIMING_SCOPE records latency histograms
 #define C_TOOLBOX_LOG_COMMAND 0
 
 #define C_TOOLBOX_THREAD_AND_MUTEX 0
@@ -22,6 +23,8 @@
 #define C_TOOLBOX_HTTP_SERVER 0
 #define C_TOOLBOX_XML 0
 #define C_TOOLBOX_GENERIC_TREE 1
+#define C_TOOLBOX_GENERIC_TREE_RWLOCK 0 // genericTree_T gets a reader-writer lock, link with -lpthread
+#define C_TOOLBOX_GENERIC_TREE_SNAPSHOT 1
 #define C_TOOLBOX_BINARY_TREE 0
 #define C_TOOLBOX_CRYPT 0
 
@@ -0,0 +1,465 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-date.c
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Calendar conversion and cached timestamp formatting, see toolbox-date.h
+//      Also implements C_Timestring, C_epoch2date and C_dateToEpoch of toolbox.h
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include <string.h>
+#include <time.h>
+#include <wchar.h>
+
+#include "toolbox.h"
+#include "toolbox-errors.h"
+#include "toolbox-date.h"
+
+#if defined(_MSC_VER)
+#	include <windows.h>
+#	define DATE_THREAD_LOCAL __declspec(thread)
+#else
+#	define DATE_THREAD_LOCAL __thread
+#endif
+
+#define DATE_PREFIX_LENGTH 19 // "YYYY-MM-DD HH:MM:SS"
+
+typedef struct dateCache_S
+{
+	int64_t second[2]; // indexed by utc, epoch of prefix
+	char prefix[2][DATE_PREFIX_LENGTH + 1];
+	int valid[2];
+	int64_t offset_minute; // epoch/60 the offset was computed for
+	int offset;
+	int offset_valid;
+} dateCache_T;
+
+static DATE_THREAD_LOCAL dateCache_T t_date;
+
+static const char g_date_months[12][4] = { "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+
+// written 19.Oct.2026
+int64_t C_daysFromCivil(int64_t year, unsigned int month, unsigned int day)
+{
+	// years start in March so the leap day is the last day of the year
+	int64_t era;
+	unsigned int year_of_era;
+	unsigned int day_of_year;
+	unsigned int day_of_era;
+
+	year -= month <= 2;
+	era = (year >= 0 ? year : year - 399) / 400;
+	year_of_era = (unsigned int)(year - era * 400);
+	day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+	day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+	return era * 146097 + (int64_t)day_of_era - 719468;
+}
+
+// written 19.Oct.2026
+void C_civilFromDays(int64_t days, int64_t * year, unsigned int * month, unsigned int * day)
+{
+	int64_t era;
+	unsigned int day_of_era;
+	unsigned int year_of_era;
+	unsigned int day_of_year;
+	unsigned int month_from_march;
+
+	days += 719468;
+	era = (days >= 0 ? days : days - 146096) / 146097;
+	day_of_era = (unsigned int)(days - era * 146097);
+	year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+	day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+	month_from_march = (5 * day_of_year + 2) / 153;
+
+	if ( day ) *day = day_of_year - (153 * month_from_march + 2) / 5 + 1;
+	if ( month ) *month = month_from_march < 10 ? month_from_march + 3 : month_from_march - 9;
+	if ( year ) *year = (int64_t)year_of_era + era * 400 + (month_from_march >= 10);
+}
+
+static int64_t date_floorDiv(int64_t value, int64_t divisor)
+{
+	return (value >= 0 ? value : value - divisor + 1) / divisor;
+}
+
+// written 19.Oct.2026
+int C_localUtcOffset(int64_t epoch)
+{
+	int64_t minute = date_floorDiv(epoch, 60);
+	time_t when;
+	struct tm broken;
+	int64_t local;
+
+	if ( t_date.offset_valid && t_date.offset_minute == minute )
+	{
+		return t_date.offset;
+	}
+
+	when = (time_t)epoch;
+#if defined(_MSC_VER)
+	if ( localtime_s(&broken, &when) != 0 )
+#else
+	if ( localtime_r(&when, &broken) == NULL )
+#endif
+	{
+		return 0;
+	}
+	local = C_daysFromCivil((int64_t)broken.tm_year + 1900, (unsigned int)broken.tm_mon + 1, (unsigned int)broken.tm_mday) * 86400
+	      + broken.tm_hour * 3600 + broken.tm_min * 60 + broken.tm_sec;
+
+	t_date.offset = (int)(local - epoch);
+	t_date.offset_minute = minute;
+	t_date.offset_valid = 1;
+	return t_date.offset;
+}
+
+static void date_write2(char * loadme, unsigned int value)
+{
+	loadme[0] = (char)('0' + value / 10);
+	loadme[1] = (char)('0' + value % 10);
+}
+
+static void date_buildPrefix(int64_t local, char * prefix)
+{
+	int64_t days = date_floorDiv(local, 86400);
+	unsigned int second_of_day = (unsigned int)(local - days * 86400);
+	int64_t year;
+	unsigned int month;
+	unsigned int day;
+
+	C_civilFromDays(days, &year, &month, &day);
+	if ( year < 0 || year > 9999 )
+	{
+		year = year < 0 ? 0 : 9999; // keep the fixed width
+	}
+	date_write2(prefix, (unsigned int)(year / 100));
+	date_write2(prefix + 2, (unsigned int)(year % 100));
+	prefix[4] = '-';
+	date_write2(prefix + 5, month);
+	prefix[7] = '-';
+	date_write2(prefix + 8, day);
+	prefix[10] = ' ';
+	date_write2(prefix + 11, second_of_day / 3600);
+	prefix[13] = ':';
+	date_write2(prefix + 14, second_of_day / 60 % 60);
+	prefix[16] = ':';
+	date_write2(prefix + 17, second_of_day % 60);
+	prefix[DATE_PREFIX_LENGTH] = '\0';
+}
+
+// written 19.Oct.2026
+int C_formatDate(int64_t epoch, unsigned int nanoseconds, int sub_digits, int utc, char * loadme, size_t loadme_size)
+{
+	int length;
+	int i;
+
+	if ( loadme == NULL )
+	{
+		return -2;
+	}
+	if ( sub_digits < 0 || sub_digits > 9 || nanoseconds > 999999999 )
+	{
+		return -3;
+	}
+	utc = utc ? 1 : 0;
+	length = DATE_PREFIX_LENGTH + (sub_digits ? 1 + sub_digits : 0);
+	if ( loadme_size <= (size_t)length )
+	{
+		if ( loadme_size > 0 ) loadme[0] = '\0';
+		return TOOLBOX_ERROR_BUFFER_TOO_SMALL;
+	}
+
+	if ( t_date.valid[utc] == 0 || t_date.second[utc] != epoch )
+	{
+		date_buildPrefix(utc ? epoch : epoch + C_localUtcOffset(epoch), t_date.prefix[utc]);
+		t_date.second[utc] = epoch;
+		t_date.valid[utc] = 1;
+	}
+	memcpy(loadme, t_date.prefix[utc], DATE_PREFIX_LENGTH);
+
+	if ( sub_digits )
+	{
+		loadme[DATE_PREFIX_LENGTH] = '.';
+		for (i = 9; i > sub_digits; i--)
+		{
+			nanoseconds /= 10;
+		}
+		for (i = length - 1; i > DATE_PREFIX_LENGTH; i--)
+		{
+			loadme[i] = (char)('0' + nanoseconds % 10);
+			nanoseconds /= 10;
+		}
+	}
+	loadme[length] = '\0';
+	return length;
+}
+
+#if C_TOOLBOX_TIMING == 1
+
+static void date_now(int64_t * epoch, unsigned int * nanoseconds)
+{
+#if defined(_MSC_VER)
+	FILETIME file_time;
+	uint64_t ticks; // 100 ns since 1601
+	GetSystemTimeAsFileTime(&file_time);
+	ticks = ((uint64_t)file_time.dwHighDateTime << 32) | file_time.dwLowDateTime;
+	ticks -= 116444736000000000ULL;
+	*epoch = (int64_t)(ticks / 10000000);
+	*nanoseconds = (unsigned int)(ticks % 10000000) * 100;
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_REALTIME, &now);
+	*epoch = (int64_t)now.tv_sec;
+	*nanoseconds = (unsigned int)now.tv_nsec;
+#endif
+}
+
+// Modified 19.Oct.2026, local "YYYY-MM-DD HH:MM:SS.mmm" from the per-thread cache
+int C_Timestring(char * loadme, unsigned int loadme_size)
+{
+	int64_t epoch;
+	unsigned int nanoseconds;
+	int iret;
+
+	if ( loadme == NULL )
+	{
+		return -1;
+	}
+	date_now(&epoch, &nanoseconds);
+	iret = C_formatDate(epoch, nanoseconds, 3, TOOLBOX_DATE_LOCAL, loadme, loadme_size);
+	if ( iret < 0 )
+	{
+		return iret;
+	}
+	return 1;
+}
+
+// Modified 19.Oct.2026
+int C_TimestringW(wchar_t * loadme, unsigned int loadme_size)
+{
+	char narrow[TOOLBOX_TIMESTRING_SIZE];
+	int iret;
+	int i;
+
+	if ( loadme == NULL )
+	{
+		return -1;
+	}
+	// loadme_size counts wchar_t
+	iret = C_Timestring(narrow, loadme_size < sizeof(narrow) ? loadme_size : sizeof(narrow));
+	if ( iret <= 0 )
+	{
+		if ( loadme_size > 0 ) loadme[0] = L'\0';
+		return iret;
+	}
+	for (i = 0; narrow[i]; i++)
+	{
+		loadme[i] = (wchar_t)narrow[i];
+	}
+	loadme[i] = L'\0';
+	return 1;
+}
+
+// Modified 19.Oct.2026, days from civil instead of localtime, local time zone.
+// year needs 5 bytes (up to 9999), month 4, month_digit 3, day 3. Any can be NULL.
+int C_epoch2date(int64_t epoch, char * year, char * month, char * month_digit, char * day, int * hours, int * minutes, int * seconds)
+{
+	int64_t local = epoch + C_localUtcOffset(epoch);
+	int64_t days = date_floorDiv(local, 86400);
+	unsigned int second_of_day = (unsigned int)(local - days * 86400);
+	int64_t civil_year;
+	unsigned int civil_month;
+	unsigned int civil_day;
+
+	C_civilFromDays(days, &civil_year, &civil_month, &civil_day);
+	if ( civil_year < 0 || civil_year > 9999 )
+	{
+		return TOOLBOX_ERROR_OUT_OF_RANGE;
+	}
+
+	if ( year )
+	{
+		date_write2(year, (unsigned int)(civil_year / 100));
+		date_write2(year + 2, (unsigned int)(civil_year % 100));
+		year[4] = '\0';
+	}
+	if ( month )
+	{
+		memcpy(month, g_date_months[civil_month - 1], 4);
+	}
+	if ( month_digit )
+	{
+		date_write2(month_digit, civil_month);
+		month_digit[2] = '\0';
+	}
+	if ( day )
+	{
+		date_write2(day, civil_day);
+		day[2] = '\0';
+	}
+	if ( hours ) *hours = (int)(second_of_day / 3600);
+	if ( minutes ) *minutes = (int)(second_of_day / 60 % 60);
+	if ( seconds ) *seconds = (int)(second_of_day % 60);
+	return 1;
+}
+
+// Modified 19.Oct.2026
+int C_epoch2dateW(int64_t epoch, wchar_t * year, wchar_t * month, wchar_t * month_digit, wchar_t * day, int * hours, int * minutes, int * seconds)
+{
+	char narrow[4][5];
+	wchar_t * wide[4];
+	int iret;
+	int i;
+	int j;
+
+	iret = C_epoch2date(epoch, narrow[0], narrow[1], narrow[2], narrow[3], hours, minutes, seconds);
+	if ( iret <= 0 )
+	{
+		return iret;
+	}
+	wide[0] = year;
+	wide[1] = month;
+	wide[2] = month_digit;
+	wide[3] = day;
+	for (i = 0; i < 4; i++)
+	{
+		if ( wide[i] == NULL ) continue;
+		for (j = 0; narrow[i][j]; j++)
+		{
+			wide[i][j] = (wchar_t)narrow[i][j];
+		}
+		wide[i][j] = L'\0';
+	}
+	return 1;
+}
+
+// fixed count of digits, returns -1 if one is missing
+static int date_digits(const char ** cursor, int count)
+{
+	int value = 0;
+	const char * p = *cursor;
+	while ( count-- )
+	{
+		if ( *p < '0' || *p > '9' )
+		{
+			return -1;
+		}
+		value = value * 10 + (*p++ - '0');
+	}
+	*cursor = p;
+	return value;
+}
+
+// Modified 19.Oct.2026
+// "YYYY-MM-DD[ T]HH:MM[:SS[.fraction]][Z]" (C_Timestring) or "DD.Mon.YYYY" (C_getCompileDate).
+// Local time unless it ends with 'Z'. Fraction is ignored.
+int C_dateToEpoch(const char * date, uint64_t * epoch)
+{
+	const char * p = date;
+	int year = 0;
+	int month = 0;
+	int day = 0;
+	int hour = 0;
+	int minute = 0;
+	int second = 0;
+	int utc = 0;
+	int64_t local;
+	int64_t guess;
+	int i;
+
+	if ( date == NULL )
+	{
+		return -1;
+	}
+	if ( epoch == NULL )
+	{
+		return -2;
+	}
+
+	if ( p[0] && p[1] && p[2] == '.' )
+	{
+		day = date_digits(&p, 2);
+		if ( day < 0 || *p++ != '.' )
+		{
+			return -10;
+		}
+		for (i = 0; i < 12; i++)
+		{
+			if ( strncasecmp(p, g_date_months[i], 3) == 0 ) break;
+		}
+		if ( i == 12 || p[3] != '.' )
+		{
+			return -10;
+		}
+		month = i + 1;
+		p += 4;
+		year = date_digits(&p, 4);
+		if ( year < 0 )
+		{
+			return -10;
+		}
+	}
+	else
+	{
+		year = date_digits(&p, 4);
+		if ( year < 0 || *p++ != '-' ) return -10;
+		month = date_digits(&p, 2);
+		if ( month < 0 || *p++ != '-' ) return -10;
+		day = date_digits(&p, 2);
+		if ( day < 0 ) return -10;
+		if ( *p == ' ' || *p == 'T' )
+		{
+			p++;
+			hour = date_digits(&p, 2);
+			if ( hour < 0 || *p++ != ':' ) return -10;
+			minute = date_digits(&p, 2);
+			if ( minute < 0 ) return -10;
+			if ( *p == ':' )
+			{
+				p++;
+				second = date_digits(&p, 2);
+				if ( second < 0 ) return -10;
+				if ( *p == '.' )
+				{
+					p++;
+					while ( *p >= '0' && *p <= '9' ) p++;
+				}
+			}
+		}
+		if ( *p == 'Z' )
+		{
+			utc = 1;
+			p++;
+		}
+	}
+
+	if ( month < 1 || month > 12 || day < 1 || day > 31 || hour > 23 || minute > 59 || second > 60 )
+	{
+		return TOOLBOX_ERROR_OUT_OF_RANGE;
+	}
+	local = C_daysFromCivil(year, (unsigned int)month, (unsigned int)day) * 86400 + hour * 3600 + minute * 60 + second;
+	if ( utc == 0 )
+	{
+		// the offset depends on the instant, correct once with the offset found at the first guess
+		guess = local - C_localUtcOffset(local);
+		local = local - C_localUtcOffset(guess);
+	}
+	if ( local < 0 )
+	{
+		return TOOLBOX_ERROR_OUT_OF_RANGE;
+	}
+	*epoch = (uint64_t)local;
+	return 1;
+}
+
+#endif // C_TOOLBOX_TIMING
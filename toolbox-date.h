@@ -0,0 +1,64 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-date.h
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Calendar conversion and timestamp formatting for logs.
+//      Epoch to civil date is integer arithmetic (days from civil, proleptic
+//      Gregorian), no localtime and no struct tm.
+//      Each thread keeps the last formatted "YYYY-MM-DD HH:MM:SS" and the
+//      second it stands for, so calls within the same second only write the
+//      sub-second digits. The local UTC offset is asked to the C library at
+//      most once per minute per thread, DST changes on a minute boundary.
+//      C_Timestring, C_epoch2date and C_dateToEpoch (toolbox.h) use this.
+//
+//  Limitations:
+//      Local time is the process time zone, offsets that are not whole
+//      seconds do not exist in practice and are not handled.
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef __C_TOOLBOX_DATE_H__
+#define __C_TOOLBOX_DATE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include "toolbox-basic-types.h"
+
+// "2026-10-19 14:03:07.123456789" and '\0'
+#define TOOLBOX_DATE_STRING_SIZE 30
+// C_Timestring: "2026-10-19 14:03:07.123" and '\0'
+#define TOOLBOX_TIMESTRING_SIZE 24
+
+#define TOOLBOX_DATE_LOCAL 0
+#define TOOLBOX_DATE_UTC 1
+
+// days since 1970-01-01, month 1-12, day 1-31
+int64_t C_daysFromCivil(int64_t year, unsigned int month, unsigned int day);
+void C_civilFromDays(int64_t days, int64_t * year, unsigned int * month, unsigned int * day);
+
+// seconds east of UTC for the local time zone at epoch, cached per minute per thread
+int C_localUtcOffset(int64_t epoch);
+
+// "YYYY-MM-DD HH:MM:SS" followed by '.' and sub_digits (0 to 9) digits of nanoseconds.
+// Returns the length written, or TOOLBOX_ERROR_BUFFER_TOO_SMALL.
+int C_formatDate(int64_t epoch, unsigned int nanoseconds, int sub_digits, int utc, char * loadme, size_t loadme_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
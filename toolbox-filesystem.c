@@ -64,6 +64,7 @@ int traverseDir(const char* directory, fileEntryCallback_func f_callback, void *
 	char szFullPathName[512];
 
 	fileEntry_T curEntry;
+	TOOLBOX_TIMING_SCOPE("traverseDir");
 
 	if (directory == NULL) return -1;
 	if (f_callback == NULL) return -2;
@@ -101,7 +102,7 @@ int traverseDir(const char* directory, fileEntryCallback_func f_callback, void *
 				}
 				else
 				{
-					printf("lstat failed for \"%s\", errno=%d.\n", szFullPathName);
+					TOOLBOX_LOG(TOOLBOX_LOG_WARNING, "lstat failed for \"%s\", errno=%d.\n", szFullPathName, errno);
 				}
 
 			}
@@ -24,27 +24,120 @@
 #include <string.h>
 
 
+// ASCII lower-case, big endian so the prefixes order like C_strcasecmpAscii
+static uint64_t flexstr_prefix(const char * str, unsigned int length)
+{
+   uint64_t prefix = 0;
+   unsigned int i;
+   for (i = 0; i < 8; i++)
+   {
+      prefix = (prefix << 8) | (i < length ? g_toolbox_ascii_lower[(unsigned char)str[i]] : 0);
+   }
+   return prefix;
+}
+
+// written 19.Oct.2026
+uint32_t flexstrhash(const char * str, unsigned int length)
+{
+   uint32_t hash = 2166136261u;
+   unsigned int i;
+   for (i = 0; i < length; i++)
+   {
+      hash = (hash ^ g_toolbox_ascii_lower[(unsigned char)str[i]]) * 16777619u;
+   }
+   return hash ? hash : 1;
+}
+
+// Modified 19.Oct.2026, length is taken once, see flexstrncpy
 int flexstrcpy(flexString_T * base, const char * str)
 {
-   if (strlen(str) >= sizeof(base->fixed))
+   if (base == NULL)
    {
-      // allocate
-      if (base->buffersize > 0) base->buffer[0] = '\0';
-      return C_Append(&base->buffer, &base->buffersize, str, 0/*max_length*/, NULL/*separator*/);
+      return -1;
+   }
+   if (str == NULL)
+   {
+      return -2;
    }
+   return flexstrncpy(base, str, (unsigned int)strlen(str));
+}
+
+// written 19.Oct.2026
+int flexstrncpy(flexString_T * base, const char * str, unsigned int length)
+{
+   char * buffer;
 
-   strcpy(base->fixed, str);
+   if (base == NULL)
+   {
+      return -1;
+   }
+   if (str == NULL)
+   {
+      return -2;
+   }
+
+   if (length >= sizeof(base->fixed))
+   {
+      // allocate
+      if (base->buffersize < length + 1)
+      {
+         buffer = (char*)realloc(base->buffersize > 0 ? base->buffer : NULL, length + 1);
+         if (buffer == NULL)
+         {
+            return TOOLBOX_ERROR_MALLOC;
+         }
+         base->buffer = buffer;
+         base->buffersize = length + 1;
+      }
+      memmove(base->buffer, str, length);
+      base->buffer[length] = '\0';
+   }
+   else
+   {
+      memmove(base->fixed, str, length);
+      base->fixed[length] = '\0';
+      if (base->buffersize > 0)
+      {
+         // buffer has priority, a short string after a long one must not leave it valid
+         free(base->buffer);
+         base->buffer = NULL;
+         base->buffersize = 0;
+      }
+   }
 
+   base->length = length;
+   base->hash = flexstrhash(str, length);
+   base->prefix = flexstr_prefix(str, length);
 	return 1;
 }
 
+// written 19.Oct.2026
+int flexString_Destructor(flexString_T * base)
+{
+   if (base == NULL)
+   {
+      return -1;
+   }
+   if (base->buffersize > 0)
+   {
+      free(base->buffer);
+   }
+   base->buffer = NULL;
+   base->buffersize = 0;
+   base->fixed[0] = '\0';
+   base->length = 0;
+   base->hash = 0;
+   base->prefix = 0;
+   return 1;
+}
+
 int flexstrcasecmp(flexString_T * base, const char * str)
 {
    if (base->buffersize > 0)
    {
-      return strcasecmp(base->buffer, str);
+      return C_strcasecmpAscii(base->buffer, str);
    }
-   return strcasecmp(base->fixed, str);
+   return C_strcasecmpAscii(base->fixed, str);
 }
 
 int flexstrcmp(flexString_T * base, const char * str)
@@ -56,4 +149,49 @@ int flexstrcmp(flexString_T * base, const char * str)
    return strcmp(base->fixed, str);
 }
 
+// written 19.Oct.2026
+int flexstrkey(flexStringKey_T * key, const char * str, unsigned int length)
+{
+   if (key == NULL)
+   {
+      return -1;
+   }
+   if (str == NULL)
+   {
+      return -2;
+   }
+   key->str = str;
+   key->length = length;
+   key->hash = flexstrhash(str, length);
+   key->prefix = flexstr_prefix(str, length);
+   return 1;
+}
+
+// written 19.Oct.2026
+int flexstrcasecmpkey(flexString_T * base, const flexStringKey_T * key)
+{
+   if (base->hash != 0)
+   {
+      if (base->prefix != key->prefix)
+      {
+         return base->prefix < key->prefix ? -1 : 1;
+      }
+      if (base->length <= 8 && key->length <= 8)
+      {
+         return 0; // both fully in the prefix, 0 padding can not equal a character
+      }
+   }
+   return C_strcasecmpAscii(flexstrget(base), key->str);
+}
+
+// written 19.Oct.2026
+int flexstrcaseequal(flexString_T * base, const flexStringKey_T * key)
+{
+   if (base->hash != 0 && (base->length != key->length || base->hash != key->hash || base->prefix != key->prefix))
+   {
+      return 0;
+   }
+   return C_strcasecmpAscii(flexstrget(base), key->str) == 0;
+}
+
 
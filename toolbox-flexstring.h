@@ -19,6 +19,12 @@
 //               allocated under the hood. You are able to use the same functions to
 //               work on both kind.
 //
+//               Modified 19.Oct.2026: the length is stored, and a case-folded hash and
+//               8-byte prefix are kept beside the string. Equality can be rejected on
+//               length or hash, ordering on the prefix, before any byte is compared.
+//               TOOLBOX_FLEXSTRING_LENGTH can be set at compile time (e.g. -DTOOLBOX_FLEXSTRING_LENGTH=48
+//               for tree names), it must be the same for every file of a program.
+//
 //  Limitations:
 //
 //  License: Yipp Dual Personal Open Source License and Business Monetary License
@@ -33,19 +39,48 @@
 extern "C" {
 #endif
 
-#define TOOLBOX_FLEXSTRING_LENGTH 256
+#include "toolbox-basic-types.h"
+
+#ifndef TOOLBOX_FLEXSTRING_LENGTH
+#	define TOOLBOX_FLEXSTRING_LENGTH 256
+#endif
 
 typedef struct flexString_S
 {
    char fixed[TOOLBOX_FLEXSTRING_LENGTH];
    char * buffer; // used if fixed buffer is not big enough, always has more priority than fixed.
 	unsigned int buffersize; // if non-zero, this is the valid string
+	unsigned int length;
+	uint32_t hash; // flexstrhash() of the string, 0 if not computed (zeroed struct)
+	uint64_t prefix; // first 8 bytes ASCII lower-cased, big endian, 0 padded
 } flexString_T;
 
+// a string to compare against many flexString_T, see flexstrcasecmpkey
+typedef struct flexStringKey_S
+{
+	const char * str;
+	unsigned int length;
+	uint32_t hash;
+	uint64_t prefix;
+} flexStringKey_T;
+
 int flexstrcpy(flexString_T * base, const char * str);
+int flexstrncpy(flexString_T * base, const char * str, unsigned int length); // str has no '\0' in its first length bytes
+int flexString_Destructor(flexString_T * base); // frees buffer, base can be reused
 int flexstrcasecmp(flexString_T * base, const char * str);
 int flexstrcmp(flexString_T * base, const char * str);
 
+#define flexstrget(base) ((base)->buffersize > 0 ? (const char*)(base)->buffer : (const char*)(base)->fixed)
+#define flexstrlen(base) ((base)->length)
+
+// FNV-1a of the ASCII lower-cased bytes, never 0
+uint32_t flexstrhash(const char * str, unsigned int length);
+int flexstrkey(flexStringKey_T * key, const char * str, unsigned int length);
+// same sign as flexstrcasecmp, most unequal pairs are decided on the prefix alone
+int flexstrcasecmpkey(flexString_T * base, const flexStringKey_T * key);
+// 1 if equal ignoring ASCII case, rejects on length or hash first
+int flexstrcaseequal(flexString_T * base, const flexStringKey_T * key);
+
 #ifdef __cplusplus
 }
 #endif
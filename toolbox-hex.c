@@ -0,0 +1,416 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-hex.c
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Hexadecimal codec, see toolbox-hex.h
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include <string.h>
+
+#include "toolbox-errors.h"
+#include "toolbox-hex.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	include <emmintrin.h>
+#	define TOOLBOX_HEX_SSE2 1
+#	if defined(__SSSE3__)
+#		include <tmmintrin.h>
+#		define TOOLBOX_HEX_SSSE3 1
+#	endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#	include <arm_neon.h>
+#	define TOOLBOX_HEX_NEON 1
+#endif
+
+static const char g_hex_lower[] = "0123456789abcdef";
+static const char g_hex_upper[] = "0123456789ABCDEF";
+
+const unsigned char g_toolbox_hex_value[256] =
+{
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+#if defined(TOOLBOX_HEX_SSE2)
+// nibbles 0..15 to their characters
+static __m128i hex_nibbleToChar16(__m128i nibbles, const char * digits)
+{
+#	if defined(TOOLBOX_HEX_SSSE3)
+	return _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)digits), nibbles);
+#	else
+	const __m128i letter = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+	const char gap = (char)(digits[10] - '0' - 10); // 'a' or 'A' follows '9' by 39 or 7
+	return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), _mm_and_si128(letter, _mm_set1_epi8(gap)));
+#	endif
+}
+
+// 16 characters to nibbles, *valid gets 0xFF for each hex digit
+static __m128i hex_charToNibble16(__m128i block, __m128i * valid)
+{
+	const __m128i lower = _mm_or_si128(block, _mm_set1_epi8(0x20));
+	// shift each range to the bottom of the signed range so one compare finds it
+	const __m128i isDigit = _mm_cmplt_epi8(_mm_add_epi8(block, _mm_set1_epi8((char)(0x80 - '0'))), _mm_set1_epi8((char)(0x80 + 10)));
+	const __m128i isLetter = _mm_cmplt_epi8(_mm_add_epi8(lower, _mm_set1_epi8((char)(0x80 - 'a'))), _mm_set1_epi8((char)(0x80 + 6)));
+	*valid = _mm_or_si128(isDigit, isLetter);
+	return _mm_or_si128(_mm_and_si128(isDigit, _mm_sub_epi8(block, _mm_set1_epi8('0'))),
+	                    _mm_and_si128(isLetter, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+}
+#elif defined(TOOLBOX_HEX_NEON)
+static uint8x16_t hex_nibbleToChar16(uint8x16_t nibbles, const char * digits)
+{
+	const uint8x16_t letter = vcgtq_u8(nibbles, vdupq_n_u8(9));
+	const unsigned char gap = (unsigned char)(digits[10] - '0' - 10);
+	return vaddq_u8(vaddq_u8(nibbles, vdupq_n_u8('0')), vandq_u8(letter, vdupq_n_u8(gap)));
+}
+
+static uint8x16_t hex_charToNibble16(uint8x16_t block, uint8x16_t * valid)
+{
+	const uint8x16_t lower = vorrq_u8(block, vdupq_n_u8(0x20));
+	const uint8x16_t digit = vsubq_u8(block, vdupq_n_u8('0'));
+	const uint8x16_t letter = vsubq_u8(lower, vdupq_n_u8('a'));
+	const uint8x16_t isDigit = vcleq_u8(digit, vdupq_n_u8(9));
+	const uint8x16_t isLetter = vcleq_u8(letter, vdupq_n_u8(5));
+	*valid = vorrq_u8(isDigit, isLetter);
+	return vorrq_u8(vandq_u8(isDigit, digit), vandq_u8(isLetter, vaddq_u8(letter, vdupq_n_u8(10))));
+}
+#endif
+
+// loadme holds 2*length characters, no terminator
+static void hex_encode(const unsigned char * data, size_t length, char * loadme, const char * digits)
+{
+	size_t i = 0;
+
+#if defined(TOOLBOX_HEX_SSE2)
+	for (; i + 16 <= length; i += 16)
+	{
+		const __m128i bytes = _mm_loadu_si128((const __m128i*)(data + i));
+		const __m128i high = hex_nibbleToChar16(_mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0F)), digits);
+		const __m128i low = hex_nibbleToChar16(_mm_and_si128(bytes, _mm_set1_epi8(0x0F)), digits);
+		_mm_storeu_si128((__m128i*)(loadme + 2*i), _mm_unpacklo_epi8(high, low));
+		_mm_storeu_si128((__m128i*)(loadme + 2*i + 16), _mm_unpackhi_epi8(high, low));
+	}
+#elif defined(TOOLBOX_HEX_NEON)
+	for (; i + 16 <= length; i += 16)
+	{
+		const uint8x16_t bytes = vld1q_u8(data + i);
+		uint8x16x2_t pairs;
+		pairs.val[0] = hex_nibbleToChar16(vshrq_n_u8(bytes, 4), digits);
+		pairs.val[1] = hex_nibbleToChar16(vandq_u8(bytes, vdupq_n_u8(0x0F)), digits);
+		vst2q_u8((uint8_t*)(loadme + 2*i), pairs); // interleaves high and low
+	}
+#endif
+	for (; i < length; i++)
+	{
+		loadme[2*i] = digits[data[i] >> 4];
+		loadme[2*i + 1] = digits[data[i] & 0x0F];
+	}
+}
+
+// hex_length is even, returns 1 or -11
+static int hex_decode(const unsigned char * hex, size_t hex_length, unsigned char * loadme)
+{
+	size_t i = 0;
+	unsigned char high;
+	unsigned char low;
+
+#if defined(TOOLBOX_HEX_SSE2)
+	for (; i + 32 <= hex_length; i += 32)
+	{
+		__m128i validA;
+		__m128i validB;
+		const __m128i a = hex_charToNibble16(_mm_loadu_si128((const __m128i*)(hex + i)), &validA);
+		const __m128i b = hex_charToNibble16(_mm_loadu_si128((const __m128i*)(hex + i + 16)), &validB);
+		if ( _mm_movemask_epi8(_mm_and_si128(validA, validB)) != 0xFFFF )
+		{
+			return -11;
+		}
+		// each 16-bit lane holds a pair: first digit in the low byte
+		_mm_storeu_si128((__m128i*)(loadme + i/2), _mm_packus_epi16(
+			_mm_or_si128(_mm_slli_epi16(_mm_and_si128(a, _mm_set1_epi16(0x00FF)), 4), _mm_srli_epi16(a, 8)),
+			_mm_or_si128(_mm_slli_epi16(_mm_and_si128(b, _mm_set1_epi16(0x00FF)), 4), _mm_srli_epi16(b, 8))));
+	}
+#elif defined(TOOLBOX_HEX_NEON)
+	for (; i + 32 <= hex_length; i += 32)
+	{
+		const uint8x16x2_t pairs = vld2q_u8(hex + i); // first digits, second digits
+		uint8x16_t validHigh;
+		uint8x16_t validLow;
+		const uint8x16_t highs = hex_charToNibble16(pairs.val[0], &validHigh);
+		const uint8x16_t lows = hex_charToNibble16(pairs.val[1], &validLow);
+		const uint64x2_t valid = vreinterpretq_u64_u8(vandq_u8(validHigh, validLow));
+		if ( (vgetq_lane_u64(valid, 0) & vgetq_lane_u64(valid, 1)) != 0xFFFFFFFFFFFFFFFFULL )
+		{
+			return -11;
+		}
+		vst1q_u8(loadme + i/2, vorrq_u8(vshlq_n_u8(highs, 4), lows));
+	}
+#endif
+	for (; i < hex_length; i += 2)
+	{
+		high = g_toolbox_hex_value[hex[i]];
+		low = g_toolbox_hex_value[hex[i+1]];
+		if ( (high | low) & 0xF0 ) // 0xFF marks an invalid digit
+		{
+			return -11;
+		}
+		loadme[i/2] = (unsigned char)((high << 4) | low);
+	}
+	return 1;
+}
+
+// written 19.Oct.2026
+int C_hexEncode(const unsigned char * data, size_t length, char * loadme, size_t loadme_size, int uppercase)
+{
+	if ( data == NULL && length > 0 )
+	{
+		return -1;
+	}
+	if ( loadme == NULL )
+	{
+		return -2;
+	}
+	if ( loadme_size == 0 || (loadme_size - 1) / 2 < length )
+	{
+		if ( loadme_size > 0 ) loadme[0] = '\0';
+		return TOOLBOX_ERROR_BUFFER_TOO_SMALL;
+	}
+	hex_encode(data, length, loadme, uppercase ? g_hex_upper : g_hex_lower);
+	loadme[2*length] = '\0';
+	return 1;
+}
+
+// written 19.Oct.2026
+int C_hexEncodeSeparated(const unsigned char * data, size_t length, char separator, char * loadme, size_t loadme_size, int uppercase)
+{
+	const char * digits = uppercase ? g_hex_upper : g_hex_lower;
+	size_t i;
+
+	if ( data == NULL && length > 0 )
+	{
+		return -1;
+	}
+	if ( loadme == NULL )
+	{
+		return -2;
+	}
+	if ( loadme_size == 0 || (length > 0 && loadme_size / 3 < length) )
+	{
+		if ( loadme_size > 0 ) loadme[0] = '\0';
+		return TOOLBOX_ERROR_BUFFER_TOO_SMALL;
+	}
+	for (i = 0; i < length; i++)
+	{
+		loadme[3*i] = digits[data[i] >> 4];
+		loadme[3*i + 1] = digits[data[i] & 0x0F];
+		loadme[3*i + 2] = separator;
+	}
+	loadme[length ? 3*length - 1 : 0] = '\0';
+	return 1;
+}
+
+// written 19.Oct.2026
+int C_hexDecode(const char * hex, size_t hex_length, unsigned char * loadme, size_t loadme_size)
+{
+	if ( hex == NULL )
+	{
+		return -1;
+	}
+	if ( loadme == NULL && hex_length > 0 )
+	{
+		return -2;
+	}
+	if ( hex_length % 2 != 0 )
+	{
+		return -10;
+	}
+	if ( loadme_size < hex_length / 2 )
+	{
+		return TOOLBOX_ERROR_BUFFER_TOO_SMALL;
+	}
+	return hex_decode((const unsigned char*)hex, hex_length, loadme);
+}
+
+// written 19.Oct.2026
+int C_hexParseU64(const char * hex, uint64_t * value, const char ** end)
+{
+	const unsigned char * p = (const unsigned char*)hex;
+	const unsigned char * first;
+	uint64_t result = 0;
+	int overflow = 0;
+
+	if ( hex == NULL )
+	{
+		return -1;
+	}
+	if ( value == NULL )
+	{
+		return -2;
+	}
+
+	if ( p[0] == '0' && (p[1] == 'x' || p[1] == 'X') && g_toolbox_hex_value[p[2]] != 0xFF )
+	{
+		p += 2;
+	}
+	first = p;
+	while ( g_toolbox_hex_value[*p] != 0xFF )
+	{
+		if ( result >> 60 )
+		{
+			overflow = 1; // keep going so *end is past the number
+		}
+		result = (result << 4) | g_toolbox_hex_value[*p];
+		p++;
+	}
+
+	if ( end )
+	{
+		*end = (const char*)p;
+	}
+	if ( p == first )
+	{
+		*value = 0;
+		return -10;
+	}
+	if ( overflow )
+	{
+		*value = 0xFFFFFFFFFFFFFFFFULL;
+		return TOOLBOX_ERROR_OUT_OF_RANGE;
+	}
+	*value = result;
+	return 1;
+}
+
+// written 19.Oct.2026
+int hexDecoder_Constructor(hexDecoder_T * decoder, int skip_separators)
+{
+	if ( decoder == NULL )
+	{
+		return -1;
+	}
+	decoder->high = 0;
+	decoder->pending = 0;
+	decoder->skip_separators = skip_separators;
+	return 1;
+}
+
+static int hex_isSeparator(unsigned char c)
+{
+	return c == ':' || c == '-' || c == '.' || c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// written 19.Oct.2026
+int hexDecoder_Feed(hexDecoder_T * decoder, const char * chunk, size_t length, unsigned char * loadme, size_t loadme_size, size_t * written)
+{
+	const unsigned char * p = (const unsigned char*)chunk;
+	size_t out = 0;
+	size_t i = 0;
+	size_t run;
+	unsigned char nibble;
+	int iret;
+
+	if ( decoder == NULL )
+	{
+		return -1;
+	}
+	if ( chunk == NULL && length > 0 )
+	{
+		return -2;
+	}
+	if ( written )
+	{
+		*written = 0;
+	}
+	if ( loadme_size < (length + (size_t)decoder->pending) / 2 )
+	{
+		return TOOLBOX_ERROR_BUFFER_TOO_SMALL;
+	}
+
+	while ( i < length )
+	{
+		if ( decoder->pending == 0 && decoder->skip_separators == 0 )
+		{
+			// whole pairs at once, the odd digit left (if any) goes below
+			run = (length - i) & ~(size_t)1;
+			iret = hex_decode(p + i, run, loadme + out);
+			if ( iret <= 0 )
+			{
+				return iret;
+			}
+			i += run;
+			out += run / 2;
+			if ( i == length )
+			{
+				break;
+			}
+		}
+
+		nibble = g_toolbox_hex_value[p[i]];
+		if ( nibble == 0xFF )
+		{
+			if ( decoder->skip_separators && decoder->pending == 0 && hex_isSeparator(p[i]) )
+			{
+				i++;
+				continue;
+			}
+			return -11;
+		}
+		if ( decoder->pending )
+		{
+			loadme[out++] = (unsigned char)((decoder->high << 4) | nibble);
+			decoder->pending = 0;
+		}
+		else
+		{
+			decoder->high = nibble;
+			decoder->pending = 1;
+		}
+		i++;
+	}
+
+	if ( written )
+	{
+		*written = out;
+	}
+	return 1;
+}
+
+// written 19.Oct.2026
+int hexDecoder_Finish(hexDecoder_T * decoder)
+{
+	if ( decoder == NULL )
+	{
+		return -1;
+	}
+	if ( decoder->pending )
+	{
+		decoder->pending = 0;
+		return -10;
+	}
+	return 1;
+}
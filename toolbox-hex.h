@@ -0,0 +1,73 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-hex.h
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Hexadecimal encode, decode and parse.
+//      Encoding turns 16 bytes into 32 characters per step: pshufb nibble
+//      lookup with SSSE3, compare and add with SSE2 or NEON, a table otherwise.
+//      Decoding validates and converts 32 characters per step the same way.
+//      Encoding has no state, large buffers can be encoded chunk by chunk.
+//      hexDecoder_T decodes input arriving in chunks that may split a pair.
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef __C_TOOLBOX_HEX_H__
+#define __C_TOOLBOX_HEX_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include "toolbox-basic-types.h"
+
+// value of a hex digit, 0xFF if the character is not one
+extern const unsigned char g_toolbox_hex_value[256];
+
+#define TOOLBOX_HEX_LOWERCASE 0
+#define TOOLBOX_HEX_UPPERCASE 1
+
+// writes 2*length characters and '\0', loadme_size must be at least 2*length+1
+int C_hexEncode(const unsigned char * data, size_t length, char * loadme, size_t loadme_size, int uppercase);
+
+// "aa:bb:cc" style, loadme_size must be at least 3*length (or 1 if length is 0)
+int C_hexEncodeSeparated(const unsigned char * data, size_t length, char separator, char * loadme, size_t loadme_size, int uppercase);
+
+// hex_length must be even, writes hex_length/2 bytes.
+// Returns 1, -10 if hex_length is odd, -11 on a character that is not a hex digit.
+int C_hexDecode(const char * hex, size_t hex_length, unsigned char * loadme, size_t loadme_size);
+
+// optional 0x prefix, stops at the first character that is not a hex digit (*end points to it).
+// Returns 1, -10 if there is no digit, TOOLBOX_ERROR_OUT_OF_RANGE if the value needs more than 64 bits.
+int C_hexParseU64(const char * hex, uint64_t * value, const char ** end);
+
+typedef struct hexDecoder_S
+{
+	unsigned char high; // first digit of a pair split between two chunks
+	int pending;
+	int skip_separators; // ignore ':', '-', '.', spaces and line ends between pairs
+} hexDecoder_T;
+
+int hexDecoder_Constructor(hexDecoder_T * decoder, int skip_separators);
+// loadme_size must hold (pending + length) / 2 bytes, *written gets the bytes decoded.
+// Returns 1, or -11 on a character that is not a hex digit (or a separator inside a pair).
+int hexDecoder_Feed(hexDecoder_T * decoder, const char * chunk, size_t length, unsigned char * loadme, size_t loadme_size, size_t * written);
+// returns 1, or -10 if a digit is left without its pair
+int hexDecoder_Finish(hexDecoder_T * decoder);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
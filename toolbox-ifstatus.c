@@ -0,0 +1,556 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-ifstatus.c
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Shared memory interface status, see toolbox-ifstatus.h
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "toolbox-errors.h"
+#include "toolbox-ifstatus.h"
+#include "toolbox-hex.h"
+
+#if defined(__linux__)
+#	include <unistd.h>
+#	include <errno.h>
+#	include <fcntl.h>
+#	include <poll.h>
+#	include <time.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <sys/socket.h>
+#	include <arpa/inet.h>
+#	include <linux/netlink.h>
+#	include <linux/rtnetlink.h>
+#	include <linux/if_link.h>
+#endif
+
+#if defined(__linux__)
+
+#define IFSTATUS_RECEIVE_SIZE 16384
+#define IFSTATUS_READ_ATTEMPTS 1000
+
+static uint64_t ifstatus_now_ns(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+static ifStatusInterface_T * ifstatus_findInterface(ifStatusSnapshot_T * snapshot, uint32_t index)
+{
+	uint32_t i;
+	for (i = 0; i < snapshot->count; i++)
+	{
+		if ( snapshot->interfaces[i].index == index )
+		{
+			return &snapshot->interfaces[i];
+		}
+	}
+	return NULL;
+}
+
+static void ifstatus_addLink(ifStatusSnapshot_T * snapshot, struct nlmsghdr * header)
+{
+	struct ifinfomsg * message = (struct ifinfomsg*)NLMSG_DATA(header);
+	struct rtattr * attribute;
+	int attribute_length;
+	ifStatusInterface_T * entry;
+	int have_stats64 = 0;
+
+	if ( snapshot->count >= TOOLBOX_IFSTATUS_MAX_INTERFACES )
+	{
+		return;
+	}
+	entry = &snapshot->interfaces[snapshot->count];
+	memset(entry, 0, sizeof(ifStatusInterface_T));
+	entry->index = (uint32_t)message->ifi_index;
+	entry->flags = message->ifi_flags;
+
+	attribute_length = IFLA_PAYLOAD(header);
+	for (attribute = IFLA_RTA(message); RTA_OK(attribute, attribute_length); attribute = RTA_NEXT(attribute, attribute_length))
+	{
+		switch ( attribute->rta_type )
+		{
+			case IFLA_IFNAME:
+				strncpy(entry->name, (const char*)RTA_DATA(attribute), sizeof(entry->name)-1);
+				break;
+			case IFLA_ADDRESS:
+				if ( RTA_PAYLOAD(attribute) == 6 )
+				{
+					C_hexEncodeSeparated((const unsigned char*)RTA_DATA(attribute), 6, ':', entry->mac, sizeof(entry->mac), TOOLBOX_HEX_LOWERCASE);
+				}
+				break;
+			case IFLA_STATS64:
+				if ( RTA_PAYLOAD(attribute) >= sizeof(struct rtnl_link_stats64) )
+				{
+					struct rtnl_link_stats64 stats;
+					memcpy(&stats, RTA_DATA(attribute), sizeof(stats)); // attribute is only 4-byte aligned
+					entry->rx_bytes = stats.rx_bytes;
+					entry->tx_bytes = stats.tx_bytes;
+					entry->rx_packets = stats.rx_packets;
+					entry->tx_packets = stats.tx_packets;
+					entry->rx_errors = stats.rx_errors;
+					entry->tx_errors = stats.tx_errors;
+					entry->collisions = stats.collisions;
+					have_stats64 = 1;
+				}
+				break;
+			case IFLA_STATS:
+				if ( have_stats64 == 0 && RTA_PAYLOAD(attribute) >= sizeof(struct rtnl_link_stats) )
+				{
+					const struct rtnl_link_stats * stats = (const struct rtnl_link_stats*)RTA_DATA(attribute);
+					entry->rx_bytes = stats->rx_bytes;
+					entry->tx_bytes = stats->tx_bytes;
+					entry->rx_packets = stats->rx_packets;
+					entry->tx_packets = stats->tx_packets;
+					entry->rx_errors = stats->rx_errors;
+					entry->tx_errors = stats->tx_errors;
+					entry->collisions = stats->collisions;
+				}
+				break;
+		}
+	}
+	snapshot->count++;
+}
+
+static void ifstatus_addAddress(ifStatusSnapshot_T * snapshot, struct nlmsghdr * header)
+{
+	struct ifaddrmsg * message = (struct ifaddrmsg*)NLMSG_DATA(header);
+	struct rtattr * attribute;
+	int attribute_length;
+	const void * address = NULL;
+	const void * local = NULL;
+	ifStatusInterface_T * entry;
+	ifStatusAddress_T * slot;
+
+	if ( message->ifa_family != AF_INET && message->ifa_family != AF_INET6 )
+	{
+		return;
+	}
+	entry = ifstatus_findInterface(snapshot, message->ifa_index);
+	if ( entry == NULL || entry->address_count >= TOOLBOX_IFSTATUS_MAX_ADDRESSES )
+	{
+		return;
+	}
+
+	attribute_length = IFA_PAYLOAD(header);
+	for (attribute = IFA_RTA(message); RTA_OK(attribute, attribute_length); attribute = RTA_NEXT(attribute, attribute_length))
+	{
+		if ( attribute->rta_type == IFA_ADDRESS ) address = RTA_DATA(attribute);
+		else if ( attribute->rta_type == IFA_LOCAL ) local = RTA_DATA(attribute);
+	}
+	if ( local )
+	{
+		address = local; // IFA_ADDRESS is the peer on point to point links
+	}
+	if ( address == NULL )
+	{
+		return;
+	}
+
+	slot = &entry->addresses[entry->address_count];
+	if ( inet_ntop(message->ifa_family, address, slot->address, sizeof(slot->address)) == NULL )
+	{
+		return;
+	}
+	slot->family = (message->ifa_family == AF_INET) ? TOOLBOX_IFSTATUS_IPV4 : TOOLBOX_IFSTATUS_IPV6;
+	slot->prefix_length = message->ifa_prefixlen;
+	entry->address_count++;
+}
+
+// one netlink dump request, answers go to the snapshot
+static int ifstatus_dump(int fd, int type, ifStatusSnapshot_T * snapshot)
+{
+	struct
+	{
+		struct nlmsghdr header;
+		struct rtgenmsg message;
+	} request;
+	struct sockaddr_nl kernel;
+	unsigned int buffer[IFSTATUS_RECEIVE_SIZE/sizeof(unsigned int)];
+	ssize_t received;
+
+	memset(&request, 0, sizeof(request));
+	request.header.nlmsg_len = NLMSG_LENGTH(sizeof(struct rtgenmsg));
+	request.header.nlmsg_type = type;
+	request.header.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+	request.header.nlmsg_seq = (uint32_t)type; // dumps on a socket are sequential
+	request.message.rtgen_family = AF_UNSPEC;
+
+	memset(&kernel, 0, sizeof(kernel));
+	kernel.nl_family = AF_NETLINK;
+	if ( sendto(fd, &request, request.header.nlmsg_len, 0, (struct sockaddr*)&kernel, sizeof(kernel)) < 0 )
+	{
+		return -10;
+	}
+
+	for (;;)
+	{
+		struct nlmsghdr * header;
+		int remaining;
+
+		received = recv(fd, buffer, sizeof(buffer), 0);
+		if ( received < 0 )
+		{
+			if ( errno == EINTR ) continue;
+			return -11;
+		}
+		if ( received == 0 )
+		{
+			return -11;
+		}
+
+		remaining = (int)received;
+		for (header = (struct nlmsghdr*)buffer; NLMSG_OK(header, remaining); header = NLMSG_NEXT(header, remaining))
+		{
+			if ( header->nlmsg_seq != request.header.nlmsg_seq )
+			{
+				continue;
+			}
+			if ( header->nlmsg_type == NLMSG_DONE )
+			{
+				return 1;
+			}
+			if ( header->nlmsg_type == NLMSG_ERROR )
+			{
+				return -12;
+			}
+			if ( header->nlmsg_type == RTM_NEWLINK )
+			{
+				ifstatus_addLink(snapshot, header);
+			}
+			else if ( header->nlmsg_type == RTM_NEWADDR )
+			{
+				ifstatus_addAddress(snapshot, header);
+			}
+		}
+	}
+}
+
+static int ifstatus_collect(int fd, ifStatusSnapshot_T * snapshot)
+{
+	int iret;
+
+	snapshot->count = 0;
+	snapshot->reserved = 0;
+	iret = ifstatus_dump(fd, RTM_GETLINK, snapshot);
+	if ( iret <= 0 )
+	{
+		return iret;
+	}
+	iret = ifstatus_dump(fd, RTM_GETADDR, snapshot);
+	if ( iret <= 0 )
+	{
+		return iret;
+	}
+	snapshot->update_ns = ifstatus_now_ns();
+	return 1;
+}
+
+static void ifstatus_publish(ifStatusSegment_T * segment, const ifStatusSnapshot_T * snapshot)
+{
+	uint32_t sequence = segment->sequence;
+
+	__atomic_store_n(&segment->sequence, sequence + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	memcpy(&segment->snapshot, snapshot, sizeof(ifStatusSnapshot_T));
+	__atomic_store_n(&segment->sequence, sequence + 2, __ATOMIC_RELEASE);
+}
+
+#endif // __linux__
+
+// written 19.Oct.2026
+int ifStatus_Collect(ifStatusSnapshot_T * snapshot)
+{
+#if defined(__linux__)
+	int fd;
+	int iret;
+
+	if ( snapshot == NULL )
+	{
+		return -1;
+	}
+
+	fd = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+	if ( fd < 0 )
+	{
+		return -10;
+	}
+	iret = ifstatus_collect(fd, snapshot);
+	close(fd);
+	return iret;
+#else
+	(void)snapshot;
+	return TOOLBOX_ERROR_NOT_SUPPORTED;
+#endif
+}
+
+// written 19.Oct.2026
+int ifStatus_RunPublisher(const char * name, unsigned int period_ms, volatile int * stop)
+{
+#if defined(__linux__)
+	ifStatusSegment_T * segment;
+	ifStatusSnapshot_T * snapshot;
+	struct sockaddr_nl groups;
+	struct pollfd watch;
+	int query_fd;
+	int event_fd;
+	int shm_fd;
+	int fret = 1;
+	int iret;
+
+	if ( stop == NULL )
+	{
+		return -1;
+	}
+	if ( name == NULL )
+	{
+		name = TOOLBOX_IFSTATUS_SHM_NAME;
+	}
+	if ( period_ms == 0 )
+	{
+		period_ms = TOOLBOX_IFSTATUS_DEFAULT_PERIOD_MS;
+	}
+
+	snapshot = (ifStatusSnapshot_T*)malloc(sizeof(ifStatusSnapshot_T));
+	if ( snapshot == NULL )
+	{
+		return TOOLBOX_ERROR_MALLOC;
+	}
+
+	// dumps on one socket, change notifications on another so they never mix
+	query_fd = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+	event_fd = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC | SOCK_NONBLOCK, NETLINK_ROUTE);
+	if ( query_fd < 0 || event_fd < 0 )
+	{
+		if ( query_fd >= 0 ) close(query_fd);
+		if ( event_fd >= 0 ) close(event_fd);
+		free(snapshot);
+		return -10;
+	}
+	memset(&groups, 0, sizeof(groups));
+	groups.nl_family = AF_NETLINK;
+	groups.nl_groups = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+	if ( bind(event_fd, (struct sockaddr*)&groups, sizeof(groups)) < 0 )
+	{
+		close(query_fd);
+		close(event_fd);
+		free(snapshot);
+		return -11;
+	}
+
+	shm_fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+	if ( shm_fd < 0 )
+	{
+		close(query_fd);
+		close(event_fd);
+		free(snapshot);
+		return TOOLBOX_ERROR_CANNOT_OPEN_FILE;
+	}
+	if ( ftruncate(shm_fd, sizeof(ifStatusSegment_T)) != 0 )
+	{
+		close(shm_fd);
+		shm_unlink(name);
+		close(query_fd);
+		close(event_fd);
+		free(snapshot);
+		return TOOLBOX_ERROR_WRITING_DISK_FULL;
+	}
+	segment = (ifStatusSegment_T*)mmap(NULL, sizeof(ifStatusSegment_T), PROT_READ | PROT_WRITE, MAP_SHARED, shm_fd, 0);
+	close(shm_fd);
+	if ( segment == MAP_FAILED )
+	{
+		shm_unlink(name);
+		close(query_fd);
+		close(event_fd);
+		free(snapshot);
+		return -12;
+	}
+
+	// a previous publisher may have left it odd
+	__atomic_store_n(&segment->sequence, (segment->sequence + 1) & ~1U, __ATOMIC_RELAXED);
+	segment->size = sizeof(ifStatusSegment_T);
+	segment->version = TOOLBOX_IFSTATUS_VERSION;
+	segment->writer_pid = (uint32_t)getpid();
+	segment->period_ms = period_ms;
+	__atomic_store_n(&segment->magic, TOOLBOX_IFSTATUS_MAGIC, __ATOMIC_RELEASE);
+
+	watch.fd = event_fd;
+	watch.events = POLLIN;
+	while ( *stop == 0 )
+	{
+		iret = ifstatus_collect(query_fd, snapshot);
+		if ( iret > 0 )
+		{
+			ifstatus_publish(segment, snapshot);
+		}
+		else
+		{
+			fret = iret;
+			break;
+		}
+
+		iret = poll(&watch, 1, (int)period_ms);
+		if ( iret > 0 )
+		{
+			// one collection covers any number of events
+			char drain[IFSTATUS_RECEIVE_SIZE];
+			while ( recv(event_fd, drain, sizeof(drain), 0) > 0 ) {}
+		}
+	}
+
+	munmap(segment, sizeof(ifStatusSegment_T));
+	shm_unlink(name);
+	close(query_fd);
+	close(event_fd);
+	free(snapshot);
+	return fret;
+#else
+	(void)name; (void)period_ms; (void)stop;
+	return TOOLBOX_ERROR_NOT_SUPPORTED;
+#endif
+}
+
+// written 19.Oct.2026
+int ifStatusReader_Open(ifStatusReader_T * reader, const char * name)
+{
+#if defined(__linux__)
+	const ifStatusSegment_T * segment;
+	struct stat status;
+	int fd;
+
+	if ( reader == NULL )
+	{
+		return -1;
+	}
+	reader->segment = NULL;
+	if ( name == NULL )
+	{
+		name = TOOLBOX_IFSTATUS_SHM_NAME;
+	}
+
+	fd = shm_open(name, O_RDONLY, 0);
+	if ( fd < 0 )
+	{
+		return TOOLBOX_ERROR_CANNOT_OPEN_FILE;
+	}
+	if ( fstat(fd, &status) != 0 || (size_t)status.st_size < sizeof(ifStatusSegment_T) )
+	{
+		close(fd);
+		return TOOLBOX_ERROR_NOT_INITIALIZED; // publisher is starting
+	}
+	segment = (const ifStatusSegment_T*)mmap(NULL, sizeof(ifStatusSegment_T), PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if ( segment == MAP_FAILED )
+	{
+		return -10;
+	}
+	if ( __atomic_load_n(&segment->magic, __ATOMIC_ACQUIRE) != TOOLBOX_IFSTATUS_MAGIC
+	  || segment->version != TOOLBOX_IFSTATUS_VERSION
+	  || segment->size != sizeof(ifStatusSegment_T) )
+	{
+		munmap((void*)segment, sizeof(ifStatusSegment_T));
+		return TOOLBOX_ERROR_NOT_INITIALIZED_OR_GOT_CORRUPTED;
+	}
+
+	reader->segment = segment;
+	return 1;
+#else
+	(void)name;
+	if ( reader ) reader->segment = NULL;
+	return TOOLBOX_ERROR_NOT_SUPPORTED;
+#endif
+}
+
+int ifStatusReader_Close(ifStatusReader_T * reader)
+{
+	if ( reader == NULL )
+	{
+		return -1;
+	}
+#if defined(__linux__)
+	if ( reader->segment )
+	{
+		munmap((void*)reader->segment, sizeof(ifStatusSegment_T));
+	}
+#endif
+	reader->segment = NULL;
+	return 1;
+}
+
+// written 19.Oct.2026
+int ifStatusReader_Read(ifStatusReader_T * reader, ifStatusSnapshot_T * snapshot)
+{
+#if defined(__linux__)
+	const ifStatusSegment_T * segment;
+	uint32_t before;
+	uint32_t after;
+	uint64_t stale_ns;
+	int attempt;
+
+	if ( reader == NULL )
+	{
+		return -1;
+	}
+	if ( snapshot == NULL )
+	{
+		return -2;
+	}
+	segment = reader->segment;
+	if ( segment == NULL )
+	{
+		return TOOLBOX_ERROR_NOT_INITIALIZED;
+	}
+
+	for (attempt = 0; attempt < IFSTATUS_READ_ATTEMPTS; attempt++)
+	{
+		before = __atomic_load_n(&segment->sequence, __ATOMIC_ACQUIRE);
+		if ( before & 1 )
+		{
+			continue; // writer is in the middle of an update
+		}
+		memcpy(snapshot, (const void*)&segment->snapshot, sizeof(ifStatusSnapshot_T));
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		after = __atomic_load_n(&segment->sequence, __ATOMIC_RELAXED);
+		if ( before == after )
+		{
+			break;
+		}
+	}
+	if ( attempt == IFSTATUS_READ_ATTEMPTS )
+	{
+		return -20; // writer died while updating
+	}
+	if ( snapshot->count > TOOLBOX_IFSTATUS_MAX_INTERFACES )
+	{
+		return TOOLBOX_ERROR_GOT_CORRUPTED;
+	}
+
+	// no update for two periods and a second, the publisher is gone
+	stale_ns = ((uint64_t)segment->period_ms * 2 + 1000) * 1000000ULL;
+	if ( ifstatus_now_ns() - snapshot->update_ns > stale_ns )
+	{
+		return 0;
+	}
+	return 1;
+#else
+	(void)reader; (void)snapshot;
+	return TOOLBOX_ERROR_NOT_SUPPORTED;
+#endif
+}
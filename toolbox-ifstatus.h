@@ -0,0 +1,124 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-ifstatus.h
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Interface status published once for every process on the machine.
+//      One publisher (`standalone --daemon`) listens to netlink link and
+//      address events, and also refreshes counters every period. It writes a
+//      snapshot of all interfaces (addresses, MAC, 64-bit counters) in a POSIX
+//      shared memory segment.
+//      Readers map the segment read-only and copy the snapshot under a
+//      sequence lock: no syscall, no lock, the writer is never blocked.
+//
+//      Sequence lock: the writer makes sequence odd, writes, makes it even.
+//      A reader retries if sequence was odd or changed while copying.
+//
+//  Limitations:
+//      Linux only, other systems get TOOLBOX_ERROR_NOT_SUPPORTED.
+//      At most TOOLBOX_IFSTATUS_MAX_INTERFACES interfaces and
+//      TOOLBOX_IFSTATUS_MAX_ADDRESSES addresses per interface are published.
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef __C_TOOLBOX_IFSTATUS_H__
+#define __C_TOOLBOX_IFSTATUS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "toolbox-basic-types.h"
+
+#define TOOLBOX_IFSTATUS_SHM_NAME "/toolbox-ifstatus"
+#define TOOLBOX_IFSTATUS_MAGIC toolbox_FOURCC('I','F','S','T')
+#define TOOLBOX_IFSTATUS_VERSION 1
+#define TOOLBOX_IFSTATUS_MAX_INTERFACES 16
+#define TOOLBOX_IFSTATUS_MAX_ADDRESSES 8
+#define TOOLBOX_IFSTATUS_NAME_SIZE 16 // IFNAMSIZ
+#define TOOLBOX_IFSTATUS_ADDRESS_SIZE 48 // fits INET6_ADDRSTRLEN
+#define TOOLBOX_IFSTATUS_MAC_SIZE 24
+#define TOOLBOX_IFSTATUS_DEFAULT_PERIOD_MS 1000
+
+#define TOOLBOX_IFSTATUS_IPV4 4
+#define TOOLBOX_IFSTATUS_IPV6 6
+
+typedef struct ifStatusAddress_S
+{
+	uint32_t family; // TOOLBOX_IFSTATUS_IPV4 or TOOLBOX_IFSTATUS_IPV6
+	uint32_t prefix_length;
+	char address[TOOLBOX_IFSTATUS_ADDRESS_SIZE];
+} ifStatusAddress_T;
+
+typedef struct ifStatusInterface_S
+{
+	char name[TOOLBOX_IFSTATUS_NAME_SIZE];
+	char mac[TOOLBOX_IFSTATUS_MAC_SIZE]; // "aa:bb:cc:dd:ee:ff" or empty
+	uint32_t index;
+	uint32_t flags; // IFF_UP, IFF_RUNNING, IFF_LOOPBACK...
+	uint32_t address_count;
+	uint32_t reserved;
+	ifStatusAddress_T addresses[TOOLBOX_IFSTATUS_MAX_ADDRESSES]; // kernel order
+	uint64_t rx_bytes;
+	uint64_t tx_bytes;
+	uint64_t rx_packets;
+	uint64_t tx_packets;
+	uint64_t rx_errors;
+	uint64_t tx_errors;
+	uint64_t collisions;
+} ifStatusInterface_T;
+
+typedef struct ifStatusSnapshot_S
+{
+	uint64_t update_ns; // CLOCK_MONOTONIC of the collection
+	uint32_t count;
+	uint32_t reserved;
+	ifStatusInterface_T interfaces[TOOLBOX_IFSTATUS_MAX_INTERFACES]; // kernel index order
+} ifStatusSnapshot_T;
+
+typedef struct ifStatusSegment_S
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t size; // sizeof(ifStatusSegment_T)
+	uint32_t writer_pid;
+	uint32_t period_ms; // counters are refreshed at least this often
+	uint32_t sequence; // odd while the writer is updating the snapshot
+	ifStatusSnapshot_T snapshot;
+} ifStatusSegment_T;
+
+typedef struct ifStatusReader_S
+{
+	const ifStatusSegment_T * segment;
+} ifStatusReader_T;
+
+// collects all interfaces now, through two netlink dumps
+int ifStatus_Collect(ifStatusSnapshot_T * snapshot);
+
+// publisher loop, returns when *stop becomes non-zero (from a signal handler for example).
+// name NULL for TOOLBOX_IFSTATUS_SHM_NAME, period_ms 0 for TOOLBOX_IFSTATUS_DEFAULT_PERIOD_MS.
+// The segment is removed on return.
+int ifStatus_RunPublisher(const char * name, unsigned int period_ms, volatile int * stop);
+
+// returns TOOLBOX_ERROR_CANNOT_OPEN_FILE if no publisher ever ran
+int ifStatusReader_Open(ifStatusReader_T * reader, const char * name);
+int ifStatusReader_Close(ifStatusReader_T * reader);
+// copies the current snapshot. Returns 1, or 0 if the publisher stopped updating it
+// (snapshot is still copied), or negative on error.
+int ifStatusReader_Read(ifStatusReader_T * reader, ifStatusSnapshot_T * snapshot);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,300 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-line-index.c
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Zero-copy line splitting, see toolbox-line-index.h
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "toolbox-errors.h"
+#include "toolbox-search.h"
+#include "toolbox-line-index.h"
+
+static int lineIndex_grow(lineIndex_T * index)
+{
+	lineSpan_T * spans;
+	int allocated = index->allocated * 2;
+
+	if ( index->spans == index->fixed )
+	{
+		spans = (lineSpan_T*)malloc(allocated * sizeof(lineSpan_T));
+		if ( spans == NULL )
+		{
+			return TOOLBOX_ERROR_MALLOC;
+		}
+		memcpy(spans, index->fixed, index->count * sizeof(lineSpan_T));
+	}
+	else
+	{
+		spans = (lineSpan_T*)realloc(index->spans, allocated * sizeof(lineSpan_T));
+		if ( spans == NULL )
+		{
+			return TOOLBOX_ERROR_MALLOC;
+		}
+	}
+	index->spans = spans;
+	index->allocated = allocated;
+	return 1;
+}
+
+// written 19.Oct.2026
+int lineIndex_Constructor(lineIndex_T * index, const char * buffer, int buffer_length, int chop_empty_lines)
+{
+	const char * cursor;
+	const char * end;
+	const char * eol;
+	size_t length;
+	int iret;
+
+	if ( index == NULL )
+	{
+		return -1;
+	}
+
+	index->base = NULL;
+	index->base_length = 0;
+	index->spans = index->fixed;
+	index->count = 0;
+	index->allocated = TOOLBOX_LINE_INDEX_FIXED;
+
+	if ( buffer == NULL )
+	{
+		return -2;
+	}
+
+	if ( buffer_length < 0 )
+	{
+		length = strlen(buffer);
+	}
+	else
+	{
+		length = (size_t)buffer_length;
+	}
+	index->base = buffer;
+	index->base_length = length;
+
+	cursor = buffer;
+	end = buffer + length;
+	while ( cursor < end )
+	{
+		eol = (const char*)memchr(cursor, '\n', end - cursor);
+		if ( eol == NULL )
+		{
+			eol = end;
+		}
+		length = eol - cursor;
+		if ( length > 0 && cursor[length-1] == '\r' )
+		{
+			length--;
+		}
+
+		if ( length > 0 || chop_empty_lines == 0 )
+		{
+			if ( index->count == index->allocated )
+			{
+				iret = lineIndex_grow(index);
+				if ( iret <= 0 )
+				{
+					lineIndex_Destructor(index);
+					return iret;
+				}
+			}
+			index->spans[index->count].offset = cursor - buffer;
+			index->spans[index->count].length = length;
+			index->count++;
+		}
+		cursor = eol + 1;
+	}
+
+	return 1;
+}
+
+int lineIndex_Destructor(lineIndex_T * index)
+{
+	if ( index == NULL )
+	{
+		return -1;
+	}
+	if ( index->spans && index->spans != index->fixed )
+	{
+		free(index->spans);
+	}
+	index->spans = index->fixed;
+	index->count = 0;
+	index->allocated = TOOLBOX_LINE_INDEX_FIXED;
+	return 1;
+}
+
+int lineIndex_getLine(lineIndex_T * index, int row, const char ** line, size_t * length)
+{
+	if ( index == NULL )
+	{
+		return -1;
+	}
+	if ( line == NULL || length == NULL )
+	{
+		return -2;
+	}
+	if ( row < 0 || row >= index->count )
+	{
+		return TOOLBOX_ERROR_OUT_OF_RANGE;
+	}
+
+	*line = index->base + index->spans[row].offset;
+	*length = index->spans[row].length;
+	return 1;
+}
+
+int lineIndex_copyLine(lineIndex_T * index, int row, char * loadme, size_t loadme_size)
+{
+	const char * line;
+	size_t length;
+	int iret;
+
+	if ( loadme == NULL || loadme_size == 0 )
+	{
+		return -2;
+	}
+	loadme[0] = '\0';
+
+	iret = lineIndex_getLine(index, row, &line, &length);
+	if ( iret <= 0 )
+	{
+		return iret;
+	}
+
+	if ( length >= loadme_size )
+	{
+		memcpy(loadme, line, loadme_size-1);
+		loadme[loadme_size-1] = '\0';
+		return TOOLBOX_ERROR_BUFFER_TOO_SMALL;
+	}
+	memcpy(loadme, line, length);
+	loadme[length] = '\0';
+	return 1;
+}
+
+// written 19.Oct.2026
+int lineIndex_getLineThatMatches(lineIndex_T * index, const char * needle, int start_row, int * row)
+{
+	const unsigned char * found;
+	const lineSpan_T * span;
+	size_t needle_length;
+	size_t position;
+	int i;
+
+	if ( index == NULL )
+	{
+		return -1;
+	}
+	if ( needle == NULL || row == NULL )
+	{
+		return -2;
+	}
+	if ( start_row < 0 )
+	{
+		start_row = 0;
+	}
+	if ( start_row >= index->count )
+	{
+		return 0;
+	}
+
+	needle_length = strlen(needle);
+	if ( needle_length == 0 )
+	{
+		*row = start_row;
+		return 1;
+	}
+
+	// search the remaining text as one block, then map each hit to its line
+	position = index->spans[start_row].offset;
+	i = start_row;
+	while ( position < index->base_length )
+	{
+		found = C_memSearch((const unsigned char*)index->base + position, index->base_length - position, (const unsigned char*)needle, needle_length);
+		if ( found == NULL )
+		{
+			return 0;
+		}
+		position = (const char*)found - index->base;
+
+		while ( i < index->count && index->spans[i].offset + index->spans[i].length <= position )
+		{
+			i++;
+		}
+		if ( i >= index->count )
+		{
+			return 0;
+		}
+		span = &index->spans[i];
+		if ( span->offset <= position && position + needle_length <= span->offset + span->length )
+		{
+			*row = i;
+			return 1;
+		}
+		if ( span->offset > position )
+		{
+			position = span->offset; // hit was in a chopped line or an end of line
+		}
+		else
+		{
+			position++; // hit crosses the end of the line
+		}
+	}
+	return 0;
+}
+
+int lineIndex_getLineThatStartsWith(lineIndex_T * index, const char * needle, int start_row, int * row)
+{
+	const char * line;
+	size_t needle_length;
+	size_t length;
+	int i;
+
+	if ( index == NULL )
+	{
+		return -1;
+	}
+	if ( needle == NULL || row == NULL )
+	{
+		return -2;
+	}
+	if ( start_row < 0 )
+	{
+		start_row = 0;
+	}
+
+	needle_length = strlen(needle);
+	for (i = start_row; i < index->count; i++)
+	{
+		line = index->base + index->spans[i].offset;
+		length = index->spans[i].length;
+		while ( length > 0 && (*line == ' ' || *line == '\t') )
+		{
+			line++;
+			length--;
+		}
+		if ( length >= needle_length && memcmp(line, needle, needle_length) == 0 )
+		{
+			*row = i;
+			return 1;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,75 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-line-index.h
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Splits a text buffer in lines without copying it.
+//      Each line is recorded as an (offset, length) span over the original
+//      buffer, all spans live in one contiguous vector. Like flexString_T the
+//      vector is fixed inside the object for short outputs and allocated
+//      when it grows beyond that.
+//      Line endings are "\n" or "\r\n", the end of line is not part of the span.
+//
+//  Limitations:
+//      The buffer must stay valid and unchanged while the index is used.
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef __C_TOOLBOX_LINE_INDEX_H__
+#define __C_TOOLBOX_LINE_INDEX_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+// spans kept inside the object before allocating
+#define TOOLBOX_LINE_INDEX_FIXED 64
+
+typedef struct lineSpan_S
+{
+	size_t offset;
+	size_t length;
+} lineSpan_T;
+
+typedef struct lineIndex_S
+{
+	const char * base;
+	size_t base_length;
+	lineSpan_T fixed[TOOLBOX_LINE_INDEX_FIXED];
+	lineSpan_T * spans; // points to fixed or to an allocated vector
+	int count;
+	int allocated;
+} lineIndex_T;
+
+// buffer_length -1 means '\0' terminated. A last line without end of line is included.
+int lineIndex_Constructor(lineIndex_T * index, const char * buffer, int buffer_length, int chop_empty_lines);
+int lineIndex_Destructor(lineIndex_T * index);
+
+// line is not terminated, use length. Returns 1, or TOOLBOX_ERROR_OUT_OF_RANGE.
+int lineIndex_getLine(lineIndex_T * index, int row, const char ** line, size_t * length);
+// copies and terminates, returns TOOLBOX_ERROR_BUFFER_TOO_SMALL if it does not fit (loadme still gets the truncated line)
+int lineIndex_copyLine(lineIndex_T * index, int row, char * loadme, size_t loadme_size);
+
+// first line from start_row whose content contains needle.
+// Returns 1 and sets *row, 0 if no line matches.
+int lineIndex_getLineThatMatches(lineIndex_T * index, const char * needle, int start_row, int * row);
+// same, but needle must be at the start of the line once leading spaces and tabs are skipped
+int lineIndex_getLineThatStartsWith(lineIndex_T * index, const char * needle, int start_row, int * row);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
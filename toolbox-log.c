@@ -0,0 +1,246 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-log.c
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Ring buffered logging, see toolbox-log.h
+//
+//      Each slot has its own sequence: 2*n+1 while message n is written in
+//      it, 2*n+2 once complete. Writers take n from one atomic counter, so
+//      they never wait. The flusher only reads slots whose sequence says
+//      they hold the message it expects.
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "toolbox-errors.h"
+#include "toolbox-log.h"
+
+extern int g_verbose;
+
+typedef struct logSlot_S
+{
+	uint64_t sequence;
+	uint64_t timestamp_ns; // CLOCK_MONOTONIC
+	int level;
+	unsigned int length;
+	char message[TOOLBOX_LOG_MESSAGE_SIZE];
+} logSlot_T;
+
+static logSlot_T g_log_ring[TOOLBOX_LOG_RING_SIZE];
+static uint64_t g_log_next = 0; // next message number
+static uint64_t g_log_flushed = 0; // first message not flushed yet
+
+static const char * const g_log_level_names[] = { "", "ERROR ", "WARNING ", "" };
+
+void toolbox_log_Write(int level, const char * format, ...)
+{
+	logSlot_T * slot;
+	struct timespec now;
+	uint64_t number;
+	va_list arguments;
+	int length;
+
+	number = __atomic_fetch_add(&g_log_next, 1, __ATOMIC_RELAXED);
+	slot = &g_log_ring[number & (TOOLBOX_LOG_RING_SIZE-1)];
+
+	__atomic_store_n(&slot->sequence, 2*number+1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	slot->timestamp_ns = (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+	slot->level = level;
+	va_start(arguments, format);
+	length = vsnprintf(slot->message, sizeof(slot->message), format, arguments);
+	va_end(arguments);
+	if ( length < 0 )
+	{
+		length = 0;
+	}
+	if ( length >= (int)sizeof(slot->message) )
+	{
+		length = sizeof(slot->message)-1;
+	}
+	slot->length = (unsigned int)length;
+
+	__atomic_store_n(&slot->sequence, 2*number+2, __ATOMIC_RELEASE);
+
+	if ( level <= g_verbose )
+	{
+		// developer mode, print right away like the printf it replaces
+		printf("%s%s", g_log_level_names[level & 3], slot->message);
+	}
+}
+
+// async-signal-safe decimal formatting, right aligned in width with pad
+static unsigned int log_formatNumber(char * loadme, uint64_t value, unsigned int width, char pad)
+{
+	char digits[24];
+	unsigned int count = 0;
+	unsigned int i = 0;
+
+	do
+	{
+		digits[count++] = (char)('0' + value % 10);
+		value /= 10;
+	} while ( value && count < sizeof(digits) );
+
+	while ( width > count )
+	{
+		loadme[i++] = pad;
+		width--;
+	}
+	while ( count )
+	{
+		loadme[i++] = digits[--count];
+	}
+	return i;
+}
+
+static void log_writeAll(int fd, const char * buffer, size_t length)
+{
+	ssize_t written;
+	while ( length > 0 )
+	{
+		written = write(fd, buffer, length);
+		if ( written <= 0 )
+		{
+			return;
+		}
+		buffer += written;
+		length -= (size_t)written;
+	}
+}
+
+static void log_writeLost(int fd, uint64_t lost)
+{
+	char line[64];
+	unsigned int length;
+
+	length = log_formatNumber(line, lost, 0, ' ');
+	memcpy(line + length, " messages lost\n", 15);
+	log_writeAll(fd, line, length + 15);
+}
+
+// Modified 19.Oct.2026, stops at a message still being written so the next flush has it,
+// messages overwritten before they were copied are counted as lost
+int toolbox_log_Flush(int fd)
+{
+	char line[TOOLBOX_LOG_MESSAGE_SIZE + 64];
+	logSlot_T * slot;
+	uint64_t first;
+	uint64_t last;
+	uint64_t number;
+	uint64_t sequence;
+	uint64_t expected;
+	uint64_t lost = 0;
+	unsigned int length;
+	const char * level_name;
+	int count = 0;
+
+	last = __atomic_load_n(&g_log_next, __ATOMIC_ACQUIRE);
+	first = __atomic_exchange_n(&g_log_flushed, last, __ATOMIC_ACQ_REL);
+	if ( first >= last )
+	{
+		return 0;
+	}
+
+	if ( last - first > TOOLBOX_LOG_RING_SIZE )
+	{
+		log_writeLost(fd, last - first - TOOLBOX_LOG_RING_SIZE);
+		first = last - TOOLBOX_LOG_RING_SIZE;
+	}
+
+	for (number = first; number < last; number++)
+	{
+		slot = &g_log_ring[number & (TOOLBOX_LOG_RING_SIZE-1)];
+		sequence = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+		if ( sequence < 2*number+2 )
+		{
+			// still being written (by the thread this signal interrupted, maybe):
+			// give the rest back unless another flush already took what follows
+			expected = last;
+			if ( __atomic_compare_exchange_n(&g_log_flushed, &expected, number, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) )
+			{
+				break;
+			}
+			lost++;
+			continue;
+		}
+		if ( sequence != 2*number+2 )
+		{
+			lost++; // already reused by a newer message
+			continue;
+		}
+
+		// "[   123.456789] WARNING message"
+		line[0] = '[';
+		length = 1 + log_formatNumber(line + 1, slot->timestamp_ns / 1000000000ULL, 6, ' ');
+		line[length++] = '.';
+		length += log_formatNumber(line + length, (slot->timestamp_ns / 1000) % 1000000, 6, '0');
+		line[length++] = ']';
+		line[length++] = ' ';
+		level_name = g_log_level_names[slot->level & 3];
+		while ( *level_name )
+		{
+			line[length++] = *level_name++;
+		}
+		memcpy(line + length, slot->message, slot->length);
+		length += slot->length;
+
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		if ( __atomic_load_n(&slot->sequence, __ATOMIC_RELAXED) != sequence )
+		{
+			lost++; // overwritten while copying
+			continue;
+		}
+		if ( length == 0 || line[length-1] != '\n' )
+		{
+			line[length++] = '\n';
+		}
+		log_writeAll(fd, line, length);
+		count++;
+	}
+	if ( lost )
+	{
+		log_writeLost(fd, lost);
+	}
+	return count;
+}
+
+static void log_signalHandler(int signal_number)
+{
+	(void)signal_number;
+	toolbox_log_Flush(STDERR_FILENO);
+}
+
+int toolbox_log_DumpOnSignal(int signal_number)
+{
+	struct sigaction action;
+
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = log_signalHandler;
+	action.sa_flags = SA_RESTART;
+	sigemptyset(&action.sa_mask);
+	if ( sigaction(signal_number, &action, NULL) != 0 )
+	{
+		return -10;
+	}
+	return 1;
+}
@@ -0,0 +1,86 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-log.h
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Debug logging that costs no I/O in steady state.
+//      TOOLBOX_LOG(level, format, ...) is removed at compile time when level is
+//      above TOOLBOX_LOG_COMPILED_LEVEL (from TOOLBOX_DEBUG_LEVEL by default).
+//      Messages that remain are formatted into a lock-free ring buffer in
+//      memory, any thread can log. Only messages at or below g_verbose are
+//      also printed right away, so the default g_verbose (0) prints nothing.
+//
+//      The ring is written out on demand with toolbox_log_Flush(), or from
+//      a signal handler installed with toolbox_log_DumpOnSignal()
+//      (kill -USR1 <pid>). Flushing only uses write(), so it is safe there.
+//
+//      Levels follow g_verbose: 1 errors, 2 warnings, 3 everything.
+//
+//  Limitations:
+//      POSIX only (write, sigaction, clock_gettime).
+//      Messages are cut at TOOLBOX_LOG_MESSAGE_SIZE.
+//      When more than TOOLBOX_LOG_RING_SIZE messages are logged between two
+//      flushes, the oldest are lost and a "messages lost" line is written.
+//      A message still being written when the flush runs (signal on the
+//      logging thread) ends the flush there, it is written by the next one.
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef __C_TOOLBOX_LOG_H__
+#define __C_TOOLBOX_LOG_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "toolbox-basic-types.h"
+
+#define TOOLBOX_LOG_ERROR 1
+#define TOOLBOX_LOG_WARNING 2
+#define TOOLBOX_LOG_DEBUG 3
+
+#ifndef TOOLBOX_LOG_COMPILED_LEVEL
+#	if defined(TOOLBOX_DEBUG_LEVEL) && TOOLBOX_DEBUG_LEVEL >= 1
+#		define TOOLBOX_LOG_COMPILED_LEVEL TOOLBOX_LOG_DEBUG
+#	else
+#		define TOOLBOX_LOG_COMPILED_LEVEL TOOLBOX_LOG_WARNING
+#	endif
+#endif
+
+#define TOOLBOX_LOG_RING_SIZE 256 // power of two
+#define TOOLBOX_LOG_MESSAGE_SIZE 200
+
+#if defined(__GNUC__)
+#	define TOOLBOX_LOG_PRINTF(a, b) __attribute__((format(printf, a, b)))
+#else
+#	define TOOLBOX_LOG_PRINTF(a, b)
+#endif
+
+// level must be a constant so the compiler drops disabled calls, arguments are then not evaluated
+#define TOOLBOX_LOG(level, ...) \
+	do { if ( (level) <= TOOLBOX_LOG_COMPILED_LEVEL ) toolbox_log_Write((level), __VA_ARGS__); } while (0)
+
+void toolbox_log_Write(int level, const char * format, ...) TOOLBOX_LOG_PRINTF(2, 3);
+
+// writes messages logged since last flush to fd (2 for stderr), oldest first.
+// Returns the number of messages written.
+int toolbox_log_Flush(int fd);
+
+// signal_number then dumps the ring to stderr, SIGUSR1 for example
+int toolbox_log_DumpOnSignal(int signal_number);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
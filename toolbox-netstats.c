@@ -0,0 +1,248 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-netstats.c
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Interface throughput sampling, see toolbox-netstats.h
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include <stdio.h>
+#include <string.h>
+
+#include "toolbox-errors.h"
+#include "toolbox-netstats.h"
+#include "toolbox-numeric.h"
+
+#if defined(__linux__)
+#	include <unistd.h>
+#	include <fcntl.h>
+#	include <time.h>
+#endif
+
+#if defined(__linux__)
+
+static uint64_t netstats_now_ns(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+static int netstats_open(const char * interface_name, const char * counter)
+{
+	char path[96];
+	snprintf(path, sizeof(path), "/sys/class/net/%s/statistics/%s", interface_name, counter);
+	return open(path, O_RDONLY | O_CLOEXEC);
+}
+
+// counter files hold one decimal number and a '\n'
+static int netstats_read(int fd, uint64_t * value)
+{
+	char buffer[32];
+	ssize_t length;
+
+	length = pread(fd, buffer, sizeof(buffer), 0);
+	if ( length <= 0 )
+	{
+		return -10;
+	}
+	if ( C_parseU64(buffer, (size_t)length, value, NULL) != 1 )
+	{
+		return TOOLBOX_ERROR_GOT_CORRUPTED;
+	}
+	return 1;
+}
+
+#endif // __linux__
+
+// written 19.Oct.2026
+int interfaceRates_Constructor(interfaceRates_T * rates, const char * interface_name, unsigned int smoothing_ms)
+{
+	if ( rates == NULL )
+	{
+		return -1;
+	}
+
+	memset(rates, 0, sizeof(interfaceRates_T));
+	rates->rx_fd = -1;
+	rates->tx_fd = -1;
+	rates->smoothing_ms = smoothing_ms ? smoothing_ms : TOOLBOX_NETSTATS_DEFAULT_SMOOTHING_MS;
+
+	if ( interface_name == NULL || interface_name[0] == '\0' )
+	{
+		return 1; // not bound yet, construct again with a name
+	}
+	if ( strlen(interface_name) >= sizeof(rates->interface_name) || strchr(interface_name, '/') )
+	{
+		return -3;
+	}
+	strcpy(rates->interface_name, interface_name);
+
+#if defined(__linux__)
+	rates->rx_fd = netstats_open(interface_name, "rx_bytes");
+	rates->tx_fd = netstats_open(interface_name, "tx_bytes");
+	if ( rates->rx_fd < 0 || rates->tx_fd < 0 )
+	{
+		interfaceRates_Destructor(rates);
+		return -10; // no such interface
+	}
+	return 1;
+#else
+	return TOOLBOX_ERROR_NOT_SUPPORTED;
+#endif
+}
+
+int interfaceRates_Destructor(interfaceRates_T * rates)
+{
+	if ( rates == NULL )
+	{
+		return -1;
+	}
+#if defined(__linux__)
+	if ( rates->rx_fd >= 0 ) close(rates->rx_fd);
+	if ( rates->tx_fd >= 0 ) close(rates->tx_fd);
+#endif
+	rates->rx_fd = -1;
+	rates->tx_fd = -1;
+	rates->samples = 0;
+	return 1;
+}
+
+int interfaceRates_ReadCounters(interfaceRates_T * rates, uint64_t * rx_bytes, uint64_t * tx_bytes)
+{
+#if defined(__linux__)
+	int iret;
+
+	if ( rates == NULL )
+	{
+		return -1;
+	}
+	if ( rx_bytes == NULL || tx_bytes == NULL )
+	{
+		return -2;
+	}
+	if ( rates->rx_fd < 0 || rates->tx_fd < 0 )
+	{
+		return TOOLBOX_ERROR_NOT_INITIALIZED;
+	}
+
+	iret = netstats_read(rates->rx_fd, rx_bytes);
+	if ( iret <= 0 )
+	{
+		return iret;
+	}
+	return netstats_read(rates->tx_fd, tx_bytes);
+#else
+	(void)rates; (void)rx_bytes; (void)tx_bytes;
+	return TOOLBOX_ERROR_NOT_SUPPORTED;
+#endif
+}
+
+// written 19.Oct.2026
+int interfaceRates_Sample(interfaceRates_T * rates)
+{
+#if defined(__linux__)
+	uint64_t rx_bytes;
+	uint64_t tx_bytes;
+	uint64_t now;
+	double seconds;
+	double alpha;
+	double rx_rate;
+	double tx_rate;
+	int iret;
+
+	iret = interfaceRates_ReadCounters(rates, &rx_bytes, &tx_bytes);
+	if ( iret <= 0 )
+	{
+		return iret;
+	}
+	now = netstats_now_ns();
+
+	if ( rates->samples == 0 || now <= rates->last_sample_ns
+	  || rx_bytes < rates->rx_bytes || tx_bytes < rates->tx_bytes ) // counters were reset
+	{
+		rates->rx_bytes = rx_bytes;
+		rates->tx_bytes = tx_bytes;
+		rates->last_sample_ns = now;
+		if ( rates->samples == 0 )
+		{
+			rates->samples = 1;
+			return 0;
+		}
+		return 1; // keep previous rates
+	}
+
+	seconds = (double)(now - rates->last_sample_ns) / 1e9;
+	rx_rate = (double)(rx_bytes - rates->rx_bytes) * 8.0 / seconds;
+	tx_rate = (double)(tx_bytes - rates->tx_bytes) * 8.0 / seconds;
+
+	if ( rates->samples == 1 )
+	{
+		rates->rx_bits_per_second = rx_rate;
+		rates->tx_bits_per_second = tx_rate;
+	}
+	else
+	{
+		// dt/(dt+tau) follows 1-exp(-dt/tau) closely without libm, any sampling period gives the same smoothing
+		alpha = seconds / (seconds + (double)rates->smoothing_ms / 1000.0);
+		rates->rx_bits_per_second += alpha * (rx_rate - rates->rx_bits_per_second);
+		rates->tx_bits_per_second += alpha * (tx_rate - rates->tx_bits_per_second);
+	}
+
+	rates->rx_bytes = rx_bytes;
+	rates->tx_bytes = tx_bytes;
+	rates->last_sample_ns = now;
+	rates->samples++;
+	return 1;
+#else
+	(void)rates;
+	return TOOLBOX_ERROR_NOT_SUPPORTED;
+#endif
+}
+
+// written 19.Oct.2026
+int C_FormatBitRate(double bits_per_second, char * loadme, int loadme_size)
+{
+	static const char * const units[] = { "b/s", "kb/s", "Mb/s", "Gb/s", "Tb/s" };
+	int unit = 0;
+
+	if ( loadme == NULL )
+	{
+		return -1;
+	}
+	if ( loadme_size <= 0 )
+	{
+		return -2;
+	}
+
+	if ( bits_per_second < 0 )
+	{
+		bits_per_second = 0;
+	}
+	while ( bits_per_second >= 1000.0 && unit < 4 )
+	{
+		bits_per_second /= 1000.0;
+		unit++;
+	}
+
+	if ( unit == 0 || bits_per_second >= 100.0 )
+	{
+		snprintf(loadme, loadme_size, "%.0f %s", bits_per_second, units[unit]);
+	}
+	else
+	{
+		snprintf(loadme, loadme_size, "%.1f %s", bits_per_second, units[unit]);
+	}
+	return 1;
+}
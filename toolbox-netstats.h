@@ -0,0 +1,74 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-netstats.h
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Per interface RX/TX throughput from the kernel 64-bit byte counters.
+//      /sys/class/net/<interface>/statistics/{rx,tx}_bytes are opened once
+//      and reread with pread, so a sample costs two small reads: no malloc,
+//      no process, no ifconfig parsing.
+//      Rates are smoothed with an exponentially weighted moving average whose
+//      time constant is independent of the sampling period.
+//
+//  Limitations:
+//      Linux only, other systems get TOOLBOX_ERROR_NOT_SUPPORTED.
+//      If the interface goes away, sampling fails until it is constructed again.
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef __C_TOOLBOX_NETSTATS_H__
+#define __C_TOOLBOX_NETSTATS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "toolbox-basic-types.h"
+
+#define TOOLBOX_NETSTATS_INTERFACE_SIZE 16 // IFNAMSIZ
+#define TOOLBOX_NETSTATS_DEFAULT_SMOOTHING_MS 3000
+
+typedef struct interfaceRates_S
+{
+	char interface_name[TOOLBOX_NETSTATS_INTERFACE_SIZE];
+	int rx_fd;
+	int tx_fd;
+	uint64_t rx_bytes; // counters at last sample
+	uint64_t tx_bytes;
+	uint64_t last_sample_ns; // monotonic
+	unsigned int smoothing_ms;
+	int samples;
+	double rx_bits_per_second; // smoothed
+	double tx_bits_per_second;
+} interfaceRates_T;
+
+// smoothing_ms is the EWMA time constant, 0 for TOOLBOX_NETSTATS_DEFAULT_SMOOTHING_MS
+// interface_name NULL or empty gives an object that is not bound to any interface yet.
+int interfaceRates_Constructor(interfaceRates_T * rates, const char * interface_name, unsigned int smoothing_ms);
+int interfaceRates_Destructor(interfaceRates_T * rates);
+
+// reads the counters and updates the rates.
+// Returns 1 when rates are valid, 0 on the first sample, negative on error.
+int interfaceRates_Sample(interfaceRates_T * rates);
+
+// raw 64-bit counters without rate computation
+int interfaceRates_ReadCounters(interfaceRates_T * rates, uint64_t * rx_bytes, uint64_t * tx_bytes);
+
+// "12.3 Mb/s" style, decimal units
+int C_FormatBitRate(double bits_per_second, char * loadme, int loadme_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
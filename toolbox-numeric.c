@@ -0,0 +1,343 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-numeric.c
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Decimal integer formatting and parsing, see toolbox-numeric.h
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include <string.h>
+
+#include "toolbox-errors.h"
+#include "toolbox-numeric.h"
+
+#if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_M_X64) || defined(_M_IX86) || defined(_M_ARM64)
+#	define TOOLBOX_NUMERIC_SWAR 1
+#endif
+
+// "00" to "99"
+static const char g_digit_pairs[201] =
+	"0001020304050607080910111213141516171819"
+	"2021222324252627282930313233343536373839"
+	"4041424344454647484950515253545556575859"
+	"6061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+// written 19.Oct.2026
+int C_digitCount32(uint32_t value)
+{
+	if ( value < 100000 )
+	{
+		if ( value < 100 ) return value < 10 ? 1 : 2;
+		if ( value < 10000 ) return value < 1000 ? 3 : 4;
+		return 5;
+	}
+	if ( value < 10000000 ) return value < 1000000 ? 6 : 7;
+	if ( value < 1000000000 ) return value < 100000000 ? 8 : 9;
+	return 10;
+}
+
+// written 19.Oct.2026
+int C_digitCount64(uint64_t value)
+{
+	int count = 0;
+	if ( value <= 0xFFFFFFFFULL )
+	{
+		return C_digitCount32((uint32_t)value);
+	}
+	// 4294967296 has 10 digits, strip 8 at a time so the rest fits 32 bits
+	while ( value > 0xFFFFFFFFULL )
+	{
+		value /= 100000000;
+		count += 8;
+	}
+	return count + C_digitCount32((uint32_t)value);
+}
+
+// end points one past the last digit, digits are written backward
+static void numeric_write32(uint32_t value, char * end)
+{
+	uint32_t pair;
+	while ( value >= 100 )
+	{
+		pair = (value % 100) * 2;
+		value /= 100;
+		end -= 2;
+		end[0] = g_digit_pairs[pair];
+		end[1] = g_digit_pairs[pair + 1];
+	}
+	if ( value >= 10 )
+	{
+		end -= 2;
+		end[0] = g_digit_pairs[value * 2];
+		end[1] = g_digit_pairs[value * 2 + 1];
+	}
+	else
+	{
+		end[-1] = (char)('0' + value);
+	}
+}
+
+static void numeric_write64(uint64_t value, char * end)
+{
+	uint32_t low;
+	int i;
+	// 8 digits per 64-bit step, the rest of the work stays 32-bit
+	while ( value > 0xFFFFFFFFULL )
+	{
+		low = (uint32_t)(value % 100000000);
+		value /= 100000000;
+		for (i = 0; i < 4; i++)
+		{
+			end -= 2;
+			end[0] = g_digit_pairs[(low % 100) * 2];
+			end[1] = g_digit_pairs[(low % 100) * 2 + 1];
+			low /= 100;
+		}
+	}
+	numeric_write32((uint32_t)value, end);
+}
+
+static int numeric_tooSmall(char * loadme, size_t loadme_size)
+{
+	if ( loadme != NULL && loadme_size > 0 )
+	{
+		loadme[0] = '\0';
+	}
+	return TOOLBOX_ERROR_BUFFER_TOO_SMALL;
+}
+
+// written 19.Oct.2026
+int C_u32toa(uint32_t value, char * loadme, size_t loadme_size)
+{
+	int length;
+	if ( loadme == NULL )
+	{
+		return -2;
+	}
+	length = C_digitCount32(value);
+	if ( loadme_size <= (size_t)length )
+	{
+		return numeric_tooSmall(loadme, loadme_size);
+	}
+	numeric_write32(value, loadme + length);
+	loadme[length] = '\0';
+	return length;
+}
+
+// written 19.Oct.2026
+int C_u64toa(uint64_t value, char * loadme, size_t loadme_size)
+{
+	int length;
+	if ( loadme == NULL )
+	{
+		return -2;
+	}
+	length = C_digitCount64(value);
+	if ( loadme_size <= (size_t)length )
+	{
+		return numeric_tooSmall(loadme, loadme_size);
+	}
+	numeric_write64(value, loadme + length);
+	loadme[length] = '\0';
+	return length;
+}
+
+// written 19.Oct.2026
+int C_i32toa(int32_t value, char * loadme, size_t loadme_size)
+{
+	return C_i64toa(value, loadme, loadme_size);
+}
+
+// written 19.Oct.2026
+int C_i64toa(int64_t value, char * loadme, size_t loadme_size)
+{
+	uint64_t magnitude;
+	int length;
+	if ( loadme == NULL )
+	{
+		return -2;
+	}
+	if ( value >= 0 )
+	{
+		return C_u64toa((uint64_t)value, loadme, loadme_size);
+	}
+	magnitude = 0 - (uint64_t)value; // INT64_MIN too
+	length = C_digitCount64(magnitude) + 1;
+	if ( loadme_size <= (size_t)length )
+	{
+		return numeric_tooSmall(loadme, loadme_size);
+	}
+	loadme[0] = '-';
+	numeric_write64(magnitude, loadme + length);
+	loadme[length] = '\0';
+	return length;
+}
+
+#if defined(TOOLBOX_NUMERIC_SWAR)
+// 8 characters, first one in the low byte: all '0'-'9'?
+static int numeric_eightDigits(uint64_t chunk)
+{
+	return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) | (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+}
+
+// combine neighbour digits, then pairs, then quads with multiplies
+static uint32_t numeric_eightValue(uint64_t chunk)
+{
+	const uint64_t mask = 0x000000FF000000FFULL;
+	const uint64_t mul1 = 100 + (1000000ULL << 32);
+	const uint64_t mul2 = 1 + (10000ULL << 32);
+	chunk -= 0x3030303030303030ULL;
+	chunk = (chunk * 10) + (chunk >> 8);
+	return (uint32_t)(((chunk & mask) * mul1 + ((chunk >> 16) & mask) * mul2) >> 32);
+}
+#endif
+
+// written 19.Oct.2026
+int C_parseU64(const char * text, size_t length, uint64_t * value, size_t * consumed)
+{
+	const unsigned char * p = (const unsigned char*)text;
+	uint64_t result = 0;
+	size_t i = 0;
+	unsigned int digit;
+	int overflow = 0;
+
+	if ( text == NULL && length > 0 )
+	{
+		return -1;
+	}
+	if ( value == NULL )
+	{
+		return -2;
+	}
+
+#if defined(TOOLBOX_NUMERIC_SWAR)
+	while ( i + 8 <= length )
+	{
+		uint64_t chunk;
+		uint32_t eight;
+		memcpy(&chunk, p + i, 8);
+		if ( numeric_eightDigits(chunk) == 0 )
+		{
+			break;
+		}
+		eight = numeric_eightValue(chunk);
+		if ( result > 184467440737ULL || (result == 184467440737ULL && eight > 9551615) ) // UINT64_MAX is 184467440737|09551615
+		{
+			overflow = 1;
+		}
+		result = result * 100000000 + eight;
+		i += 8;
+	}
+#endif
+	for (; i < length; i++)
+	{
+		digit = (unsigned int)p[i] - '0';
+		if ( digit > 9 )
+		{
+			break;
+		}
+		if ( result > 1844674407370955161ULL || (result == 1844674407370955161ULL && digit > 5) )
+		{
+			overflow = 1;
+		}
+		result = result * 10 + digit;
+	}
+
+	if ( consumed )
+	{
+		*consumed = i;
+	}
+	if ( i == 0 )
+	{
+		*value = 0;
+		return -10;
+	}
+	if ( overflow )
+	{
+		*value = 0xFFFFFFFFFFFFFFFFULL;
+		return TOOLBOX_ERROR_OUT_OF_RANGE;
+	}
+	*value = result;
+	return 1;
+}
+
+// written 19.Oct.2026
+int C_parseI64(const char * text, size_t length, int64_t * value, size_t * consumed)
+{
+	uint64_t magnitude = 0;
+	size_t sign = 0;
+	size_t digits = 0;
+	int negative = 0;
+	int iret;
+
+	if ( text == NULL && length > 0 )
+	{
+		return -1;
+	}
+	if ( value == NULL )
+	{
+		return -2;
+	}
+	if ( length > 0 && (text[0] == '-' || text[0] == '+') )
+	{
+		negative = (text[0] == '-');
+		sign = 1;
+	}
+
+	iret = C_parseU64(text + sign, length - sign, &magnitude, &digits);
+	if ( consumed )
+	{
+		*consumed = iret == -10 ? 0 : sign + digits;
+	}
+	if ( iret == -10 )
+	{
+		*value = 0;
+		return -10;
+	}
+	if ( negative )
+	{
+		if ( iret != 1 || magnitude > 0x8000000000000000ULL )
+		{
+			*value = (-0x7FFFFFFFFFFFFFFFLL) - 1;
+			return TOOLBOX_ERROR_OUT_OF_RANGE;
+		}
+		*value = (int64_t)(0 - magnitude);
+		return 1;
+	}
+	if ( iret != 1 || magnitude > 0x7FFFFFFFFFFFFFFFULL )
+	{
+		*value = 0x7FFFFFFFFFFFFFFFLL;
+		return TOOLBOX_ERROR_OUT_OF_RANGE;
+	}
+	*value = (int64_t)magnitude;
+	return 1;
+}
+
+// written 19.Oct.2026
+int64_t C_atoi64(const char * text)
+{
+	int64_t value = 0;
+
+	if ( text == NULL )
+	{
+		return 0;
+	}
+	while ( *text == ' ' || (*text >= '\t' && *text <= '\r') )
+	{
+		text++;
+	}
+	C_parseI64(text, strlen(text), &value, NULL);
+	return value;
+}
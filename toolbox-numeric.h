@@ -0,0 +1,66 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-numeric.h
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Decimal integer formatting and parsing without snprintf or strtoull.
+//      Formatting counts the digits first then writes two digits per step
+//      from a 200 byte pair table, divisions are by constants only.
+//      Parsing checks and converts 8 digits per step in one 64-bit word (SWAR)
+//      on little endian targets, one digit per step otherwise.
+//
+//  Limitations:
+//      Decimal only, no locale, no thousands separator.
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef __C_TOOLBOX_NUMERIC_H__
+#define __C_TOOLBOX_NUMERIC_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include "toolbox-basic-types.h"
+
+// longest output of C_i64toa with its '\0': "-9223372036854775808"
+#define TOOLBOX_NUMERIC_MAX_DIGITS 21
+
+// number of decimal digits, 1 for 0
+int C_digitCount32(uint32_t value);
+int C_digitCount64(uint64_t value);
+
+// write value and '\0', return the length written (without '\0')
+// or TOOLBOX_ERROR_BUFFER_TOO_SMALL, loadme is then set to "" if it has room for it.
+int C_u32toa(uint32_t value, char * loadme, size_t loadme_size);
+int C_u64toa(uint64_t value, char * loadme, size_t loadme_size);
+int C_i32toa(int32_t value, char * loadme, size_t loadme_size);
+int C_i64toa(int64_t value, char * loadme, size_t loadme_size);
+
+// parse the decimal digits at the start of text, at most length characters.
+// *consumed gets the characters used, the sign included, parsing stops at the first non digit.
+// Returns 1, -10 if there is no digit, TOOLBOX_ERROR_OUT_OF_RANGE if the value
+// does not fit (*value saturates, *consumed still covers every digit).
+int C_parseU64(const char * text, size_t length, uint64_t * value, size_t * consumed);
+// optional '+' or '-'
+int C_parseI64(const char * text, size_t length, int64_t * value, size_t * consumed);
+
+// atoll: leading spaces, optional sign, 0 if there is no number, saturates on overflow
+int64_t C_atoi64(const char * text);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,274 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-random.c
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Per-thread xoshiro256** generator, see toolbox-random.h
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "toolbox-errors.h"
+#include "toolbox-random.h"
+
+#if defined(_MSC_VER)
+#	define _CRT_RAND_S
+#	include <stdlib.h>
+#	include <process.h>
+#	define RANDOM_THREAD_LOCAL __declspec(thread)
+#	define random_getpid() _getpid()
+#else
+#	include <unistd.h>
+#	include <fcntl.h>
+#	include <errno.h>
+#	include <pthread.h>
+#	if defined(__linux__)
+#		include <sys/syscall.h>
+#	endif
+#	define RANDOM_THREAD_LOCAL __thread
+#	define random_getpid() getpid()
+#endif
+
+typedef struct randomState_S
+{
+	uint64_t s[4];
+	unsigned int generation; // 0 until seeded
+} randomState_T;
+
+static RANDOM_THREAD_LOCAL randomState_T t_random;
+// bumped in a forked child so it does not continue the parent sequence
+static volatile unsigned int g_random_generation = 1;
+static int g_random_atfork_done = 0;
+
+#if !defined(_MSC_VER)
+static void random_atForkChild(void)
+{
+	g_random_generation++;
+	if ( g_random_generation == 0 )
+	{
+		g_random_generation = 1;
+	}
+}
+#endif
+
+static uint64_t random_splitmix(uint64_t * x)
+{
+	uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+// returns 1 if size bytes came from the kernel
+static int random_fromKernel(void * buffer, size_t size)
+{
+#if defined(_MSC_VER)
+	unsigned int value;
+	size_t i;
+	for (i = 0; i < size; i += sizeof(value))
+	{
+		if ( rand_s(&value) != 0 )
+		{
+			return 0;
+		}
+		memcpy((char*)buffer + i, &value, size - i < sizeof(value) ? size - i : sizeof(value));
+	}
+	return 1;
+#else
+	int fd;
+	ssize_t got;
+#	if defined(__linux__) && defined(SYS_getrandom)
+	do
+	{
+		got = syscall(SYS_getrandom, buffer, size, 0);
+	} while ( got < 0 && errno == EINTR );
+	if ( got == (ssize_t)size )
+	{
+		return 1;
+	}
+#	endif
+	// kernel older than 3.17
+	fd = open("/dev/urandom", O_RDONLY);
+	if ( fd < 0 )
+	{
+		return 0;
+	}
+	got = read(fd, buffer, size);
+	close(fd);
+	return got == (ssize_t)size;
+#endif
+}
+
+static void random_seed(randomState_T * state)
+{
+	uint64_t mix;
+	int i;
+
+	if ( random_fromKernel(state->s, sizeof(state->s)) == 0 )
+	{
+		// last resort, still differs between threads, processes and calls
+		mix = (uint64_t)time(NULL) ^ ((uint64_t)random_getpid() << 32) ^ (uint64_t)(size_t)state ^ (uint64_t)clock();
+		for (i = 0; i < 4; i++)
+		{
+			state->s[i] = random_splitmix(&mix);
+		}
+	}
+	if ( (state->s[0] | state->s[1] | state->s[2] | state->s[3]) == 0 )
+	{
+		state->s[0] = 1; // all zero state never leaves zero
+	}
+#if !defined(_MSC_VER)
+	if ( __atomic_exchange_n(&g_random_atfork_done, 1, __ATOMIC_ACQ_REL) == 0 )
+	{
+		pthread_atfork(NULL, NULL, random_atForkChild);
+	}
+#endif
+	state->generation = g_random_generation;
+}
+
+static randomState_T * random_state(void)
+{
+	randomState_T * state = &t_random;
+	if ( state->generation != g_random_generation )
+	{
+		random_seed(state);
+	}
+	return state;
+}
+
+static uint64_t random_rotl(uint64_t x, int k)
+{
+	return (x << k) | (x >> (64 - k));
+}
+
+static uint64_t random_next(randomState_T * state)
+{
+	uint64_t * s = state->s;
+	uint64_t result = random_rotl(s[1] * 5, 7) * 9;
+	uint64_t t = s[1] << 17;
+
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = random_rotl(s[3], 45);
+	return result;
+}
+
+// written 19.Oct.2026
+uint64_t C_RandomU64(void)
+{
+	return random_next(random_state());
+}
+
+// written 19.Oct.2026
+uint32_t C_RandomUniform(uint32_t bound)
+{
+	randomState_T * state;
+	uint64_t product;
+	uint32_t threshold;
+
+	if ( bound == 0 )
+	{
+		return 0;
+	}
+	state = random_state();
+	product = (random_next(state) >> 32) * (uint64_t)bound;
+	if ( (uint32_t)product < bound )
+	{
+		// 2^32 % bound low values would make some results more likely
+		threshold = (uint32_t)(0 - bound) % bound;
+		while ( (uint32_t)product < threshold )
+		{
+			product = (random_next(state) >> 32) * (uint64_t)bound;
+		}
+	}
+	return (uint32_t)(product >> 32);
+}
+
+// written 19.Oct.2026
+int C_RandomFill(void * buffer, size_t size)
+{
+	randomState_T * state;
+	unsigned char * output = (unsigned char*)buffer;
+	uint64_t value;
+
+	if ( buffer == NULL )
+	{
+		return -1;
+	}
+	state = random_state();
+	while ( size >= sizeof(value) )
+	{
+		value = random_next(state);
+		memcpy(output, &value, sizeof(value));
+		output += sizeof(value);
+		size -= sizeof(value);
+	}
+	if ( size > 0 )
+	{
+		value = random_next(state);
+		memcpy(output, &value, size);
+	}
+	return 1;
+}
+
+// written 19.Oct.2026
+int C_RandomFromAlphabet(char * toload, size_t length, const char * alphabet, size_t alphabet_length)
+{
+	randomState_T * state;
+	unsigned int threshold;
+	unsigned int product;
+	uint64_t value = 0;
+	int bytes_left = 0;
+	size_t i = 0;
+
+	if ( toload == NULL )
+	{
+		return -1;
+	}
+	if ( alphabet == NULL )
+	{
+		return -2;
+	}
+	if ( alphabet_length == 0 || alphabet_length > 256 )
+	{
+		return TOOLBOX_ERROR_OUT_OF_RANGE;
+	}
+
+	// one random byte per symbol: byte * alphabet_length / 256 is the symbol,
+	// bytes whose low part falls under 256 % alphabet_length are rejected
+	state = random_state();
+	threshold = 256 % (unsigned int)alphabet_length;
+	while ( i < length )
+	{
+		if ( bytes_left == 0 )
+		{
+			value = random_next(state);
+			bytes_left = 8;
+		}
+		product = (unsigned int)(value & 0xFF) * (unsigned int)alphabet_length;
+		value >>= 8;
+		bytes_left--;
+		if ( (product & 0xFF) < threshold )
+		{
+			continue;
+		}
+		toload[i++] = alphabet[product >> 8];
+	}
+	return 1;
+}
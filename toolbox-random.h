@@ -0,0 +1,56 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-random.h
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Fast pseudo random numbers, one xoshiro256** generator per thread.
+//      Each generator is seeded once from the kernel (getrandom, /dev/urandom
+//      as fallback) and again in a child after fork, so two processes or two
+//      calls in the same second never share a sequence.
+//
+//      Bounded values use rejection sampling (Lemire), every symbol of an
+//      alphabet is equally likely.
+//
+//  Limitations:
+//      Not for cryptographic keys, xoshiro output can be predicted once
+//      enough of it was observed. Read /dev/urandom for secrets.
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef __C_TOOLBOX_RANDOM_H__
+#define __C_TOOLBOX_RANDOM_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include "toolbox-basic-types.h"
+
+uint64_t C_RandomU64(void);
+
+// uniform in [0, bound), 0 if bound is 0
+uint32_t C_RandomUniform(uint32_t bound);
+
+// fills size random bytes
+int C_RandomFill(void * buffer, size_t size);
+
+// writes length symbols picked uniformly from alphabet, no '\0' is added.
+// alphabet_length must be 1 to 256.
+int C_RandomFromAlphabet(char * toload, size_t length, const char * alphabet, size_t alphabet_length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
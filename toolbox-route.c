@@ -0,0 +1,408 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-route.c
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Default route lookup through netlink, /proc/net as fallback.
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "toolbox-errors.h"
+#include "toolbox-route.h"
+
+#if defined(__linux__)
+#	include <unistd.h>
+#	include <errno.h>
+#	include <sys/socket.h>
+#	include <arpa/inet.h>
+#	include <net/if.h>
+#	include <linux/netlink.h>
+#	include <linux/rtnetlink.h>
+#endif
+
+#if defined(__linux__)
+
+#define ROUTE_RECEIVE_SIZE 8192
+#define ROUTE_RTF_UP 0x0001
+#define ROUTE_RTF_GATEWAY 0x0002
+
+typedef struct routeList_S
+{
+	defaultRoute_T * routes;
+	int max_routes;
+	int count; // can go beyond max_routes
+} routeList_T;
+
+// keeps the array sorted, main table first, then lowest metric
+static void routeList_Add(routeList_T * list, const defaultRoute_T * route)
+{
+	int i;
+	int slot;
+
+	list->count++;
+	if ( list->max_routes <= 0 || list->routes == NULL )
+	{
+		return;
+	}
+
+	slot = (list->count <= list->max_routes) ? list->count-1 : list->max_routes;
+	for (i = slot; i > 0; i--)
+	{
+		const defaultRoute_T * other = &list->routes[i-1];
+		int route_main = (route->table == TOOLBOX_ROUTE_TABLE_MAIN);
+		int other_main = (other->table == TOOLBOX_ROUTE_TABLE_MAIN);
+		if ( other_main > route_main || (other_main == route_main && other->metric <= route->metric) )
+		{
+			break;
+		}
+		if ( i < list->max_routes )
+		{
+			list->routes[i] = *other;
+		}
+	}
+	if ( i < list->max_routes )
+	{
+		list->routes[i] = *route;
+	}
+}
+
+static int route_wantedFamily(int family, int wanted)
+{
+	return ( wanted == TOOLBOX_ROUTE_ANY || wanted == family );
+}
+
+static void route_setInterface(defaultRoute_T * route, unsigned int index)
+{
+	route->interface_index = index;
+	route->interface_name[0] = '\0';
+	if ( index > 0 && if_indextoname(index, route->interface_name) == NULL )
+	{
+		route->interface_name[0] = '\0';
+	}
+}
+
+// returns 1 if the dump was read, negative if netlink is not usable
+static int route_readNetlink(routeList_T * list, int family)
+{
+	struct
+	{
+		struct nlmsghdr header;
+		struct rtmsg message;
+	} request;
+	struct sockaddr_nl kernel;
+	unsigned int buffer[ROUTE_RECEIVE_SIZE/sizeof(unsigned int)]; // nlmsghdr alignment
+	int fd;
+	int done = 0;
+	int fret = 1;
+	ssize_t received;
+
+	fd = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+	if ( fd < 0 )
+	{
+		return -10;
+	}
+
+	memset(&request, 0, sizeof(request));
+	request.header.nlmsg_len = NLMSG_LENGTH(sizeof(struct rtmsg));
+	request.header.nlmsg_type = RTM_GETROUTE;
+	request.header.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+	request.header.nlmsg_seq = 1;
+	request.message.rtm_family = (family == TOOLBOX_ROUTE_IPV4) ? AF_INET : (family == TOOLBOX_ROUTE_IPV6) ? AF_INET6 : AF_UNSPEC;
+
+	memset(&kernel, 0, sizeof(kernel));
+	kernel.nl_family = AF_NETLINK;
+
+	if ( sendto(fd, &request, request.header.nlmsg_len, 0, (struct sockaddr*)&kernel, sizeof(kernel)) < 0 )
+	{
+		close(fd);
+		return -11;
+	}
+
+	while ( done == 0 )
+	{
+		struct nlmsghdr * header;
+		int remaining;
+
+		received = recv(fd, buffer, sizeof(buffer), 0);
+		if ( received < 0 )
+		{
+			if ( errno == EINTR ) continue;
+			fret = -12;
+			break;
+		}
+		if ( received == 0 )
+		{
+			break;
+		}
+
+		remaining = (int)received;
+		for (header = (struct nlmsghdr*)buffer; NLMSG_OK(header, remaining); header = NLMSG_NEXT(header, remaining))
+		{
+			struct rtmsg * message;
+			struct rtattr * attribute;
+			int attribute_length;
+			const void * gateway = NULL;
+			defaultRoute_T route;
+
+			if ( header->nlmsg_type == NLMSG_DONE )
+			{
+				done = 1;
+				break;
+			}
+			if ( header->nlmsg_type == NLMSG_ERROR )
+			{
+				fret = -13;
+				done = 1;
+				break;
+			}
+			if ( header->nlmsg_type != RTM_NEWROUTE )
+			{
+				continue;
+			}
+
+			message = (struct rtmsg*)NLMSG_DATA(header);
+			if ( message->rtm_dst_len != 0 || message->rtm_type != RTN_UNICAST )
+			{
+				continue; // not a default route
+			}
+			if ( message->rtm_family == AF_INET ) route.family = TOOLBOX_ROUTE_IPV4;
+			else if ( message->rtm_family == AF_INET6 ) route.family = TOOLBOX_ROUTE_IPV6;
+			else continue;
+			if ( route_wantedFamily(route.family, family) == 0 )
+			{
+				continue;
+			}
+
+			route.table = message->rtm_table;
+			route.metric = 0;
+			route.interface_index = 0;
+			route.interface_name[0] = '\0';
+
+			attribute_length = RTM_PAYLOAD(header);
+			for (attribute = RTM_RTA(message); RTA_OK(attribute, attribute_length); attribute = RTA_NEXT(attribute, attribute_length))
+			{
+				switch ( attribute->rta_type )
+				{
+					case RTA_GATEWAY: gateway = RTA_DATA(attribute); break;
+					case RTA_OIF: route_setInterface(&route, *(unsigned int*)RTA_DATA(attribute)); break;
+					case RTA_PRIORITY: route.metric = *(uint32_t*)RTA_DATA(attribute); break;
+					case RTA_TABLE: route.table = *(uint32_t*)RTA_DATA(attribute); break;
+				}
+			}
+
+			if ( gateway == NULL )
+			{
+				continue; // point to point default route, nothing to report
+			}
+			if ( inet_ntop(message->rtm_family, gateway, route.gateway, sizeof(route.gateway)) == NULL )
+			{
+				continue;
+			}
+			routeList_Add(list, &route);
+		}
+	}
+
+	close(fd);
+	return fret;
+}
+
+static int route_hexNibble(char c)
+{
+	if ( c >= '0' && c <= '9' ) return c - '0';
+	if ( c >= 'a' && c <= 'f' ) return c - 'a' + 10;
+	if ( c >= 'A' && c <= 'F' ) return c - 'A' + 10;
+	return -1;
+}
+
+// /proc/net/route
+// Iface Destination Gateway Flags RefCnt Use Metric Mask MTU Window IRTT
+// addresses are in network byte order printed as a host integer
+static int route_readProcIpv4(routeList_T * list)
+{
+	FILE * file;
+	char line[256];
+	char iface[TOOLBOX_ROUTE_INTERFACE_SIZE+1];
+	unsigned int destination, gateway, flags, refcnt, use, metric, mask;
+	struct in_addr address;
+	defaultRoute_T route;
+
+	file = fopen("/proc/net/route", "r");
+	if ( file == NULL )
+	{
+		return TOOLBOX_ERROR_CANNOT_OPEN_FILE;
+	}
+	while ( fgets(line, sizeof(line), file) )
+	{
+		if ( sscanf(line, "%16s %x %x %x %u %u %u %x", iface, &destination, &gateway, &flags, &refcnt, &use, &metric, &mask) != 8 )
+		{
+			continue; // header
+		}
+		if ( destination != 0 || mask != 0 || (flags & (ROUTE_RTF_UP|ROUTE_RTF_GATEWAY)) != (ROUTE_RTF_UP|ROUTE_RTF_GATEWAY) )
+		{
+			continue;
+		}
+		address.s_addr = gateway;
+		if ( inet_ntop(AF_INET, &address, route.gateway, sizeof(route.gateway)) == NULL )
+		{
+			continue;
+		}
+		route.family = TOOLBOX_ROUTE_IPV4;
+		route.table = TOOLBOX_ROUTE_TABLE_MAIN;
+		route.metric = metric;
+		strncpy(route.interface_name, iface, sizeof(route.interface_name)-1);
+		route.interface_name[sizeof(route.interface_name)-1] = '\0';
+		route.interface_index = if_nametoindex(route.interface_name);
+		routeList_Add(list, &route);
+	}
+	fclose(file);
+	return 1;
+}
+
+// /proc/net/ipv6_route
+// destination(32 hex) length source(32 hex) length gateway(32 hex) metric refcnt use flags iface
+static int route_readProcIpv6(routeList_T * list)
+{
+	FILE * file;
+	char line[256];
+	char destination[33], source[33], gateway[33];
+	char iface[TOOLBOX_ROUTE_INTERFACE_SIZE+1];
+	unsigned int destination_length, source_length, metric, refcnt, use, flags;
+	unsigned char address[16];
+	defaultRoute_T route;
+	int i;
+
+	file = fopen("/proc/net/ipv6_route", "r");
+	if ( file == NULL )
+	{
+		return TOOLBOX_ERROR_CANNOT_OPEN_FILE;
+	}
+	while ( fgets(line, sizeof(line), file) )
+	{
+		if ( sscanf(line, "%32s %x %32s %x %32s %x %x %x %x %16s", destination, &destination_length, source, &source_length, gateway, &metric, &refcnt, &use, &flags, iface) != 10 )
+		{
+			continue;
+		}
+		if ( destination_length != 0 || (flags & (ROUTE_RTF_UP|ROUTE_RTF_GATEWAY)) != (ROUTE_RTF_UP|ROUTE_RTF_GATEWAY) )
+		{
+			continue;
+		}
+		for (i = 0; i < 16; i++)
+		{
+			int high = route_hexNibble(gateway[2*i]);
+			int low = route_hexNibble(gateway[2*i+1]);
+			if ( high < 0 || low < 0 ) break;
+			address[i] = (unsigned char)((high << 4) | low);
+		}
+		if ( i != 16 || inet_ntop(AF_INET6, address, route.gateway, sizeof(route.gateway)) == NULL )
+		{
+			continue;
+		}
+		route.family = TOOLBOX_ROUTE_IPV6;
+		route.table = TOOLBOX_ROUTE_TABLE_MAIN;
+		route.metric = metric;
+		strncpy(route.interface_name, iface, sizeof(route.interface_name)-1);
+		route.interface_name[sizeof(route.interface_name)-1] = '\0';
+		route.interface_index = if_nametoindex(route.interface_name);
+		routeList_Add(list, &route);
+	}
+	fclose(file);
+	return 1;
+}
+
+#endif // __linux__
+
+// written 19.Oct.2026
+int C_GetDefaultRoutes(defaultRoute_T * routes, int max_routes, int family)
+{
+#if defined(__linux__)
+	routeList_T list;
+	int iret;
+	int iret6;
+
+	if ( routes == NULL && max_routes > 0 )
+	{
+		return -1;
+	}
+	if ( family != TOOLBOX_ROUTE_ANY && family != TOOLBOX_ROUTE_IPV4 && family != TOOLBOX_ROUTE_IPV6 )
+	{
+		return -2;
+	}
+
+	list.routes = routes;
+	list.max_routes = max_routes;
+	list.count = 0;
+
+	iret = route_readNetlink(&list, family);
+	if ( iret > 0 )
+	{
+		return list.count;
+	}
+
+	// netlink refused (seccomp, old kernel), read procfs
+	list.count = 0;
+	iret = 0;
+	iret6 = 0;
+	if ( route_wantedFamily(TOOLBOX_ROUTE_IPV4, family) )
+	{
+		iret = route_readProcIpv4(&list);
+	}
+	if ( route_wantedFamily(TOOLBOX_ROUTE_IPV6, family) )
+	{
+		iret6 = route_readProcIpv6(&list); // absent when IPv6 is disabled
+	}
+	if ( iret <= 0 && iret6 <= 0 )
+	{
+		return -10;
+	}
+	return list.count;
+#else
+	return TOOLBOX_ERROR_NOT_SUPPORTED;
+#endif
+}
+
+// written 19.Oct.2026
+int C_GetDefaultGatewayEx(char * gateway, int gateway_bufsize, int family)
+{
+	defaultRoute_T route;
+	int iret;
+
+	if ( gateway == NULL )
+	{
+		return -1;
+	}
+	if ( gateway_bufsize <= 0 )
+	{
+		return -2;
+	}
+
+	gateway[0] = '\0';
+	iret = C_GetDefaultRoutes(&route, 1, family);
+	if ( iret < 0 )
+	{
+		return iret;
+	}
+	if ( iret == 0 )
+	{
+		return -20; // no default route
+	}
+	if ( strlen(route.gateway) >= (unsigned int)gateway_bufsize )
+	{
+		return -11;
+	}
+	strcpy(gateway, route.gateway);
+	return 1;
+}
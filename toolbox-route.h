@@ -0,0 +1,69 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-route.h
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Default route lookup without spawning `route -n`.
+//      Linux: the kernel route table is dumped with one RTM_GETROUTE netlink
+//      request. If netlink is not available, /proc/net/route and
+//      /proc/net/ipv6_route are parsed in one pass instead.
+//      IPv4 and IPv6 default routes of every table are reported with their
+//      metric, best route first.
+//
+//  Limitations:
+//      Multipath (RTA_MULTIPATH) default routes are not reported.
+//      Not available under Windows, see C_GetDefaultGateway.
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef __C_TOOLBOX_ROUTE_H__
+#define __C_TOOLBOX_ROUTE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "toolbox-basic-types.h"
+
+#define TOOLBOX_ROUTE_ANY 0
+#define TOOLBOX_ROUTE_IPV4 4
+#define TOOLBOX_ROUTE_IPV6 6
+
+#define TOOLBOX_ROUTE_TABLE_MAIN 254
+#define TOOLBOX_ROUTE_ADDRESS_SIZE 48 // fits INET6_ADDRSTRLEN
+#define TOOLBOX_ROUTE_INTERFACE_SIZE 16 // IFNAMSIZ
+
+typedef struct defaultRoute_S
+{
+	int family; // TOOLBOX_ROUTE_IPV4 or TOOLBOX_ROUTE_IPV6
+	char gateway[TOOLBOX_ROUTE_ADDRESS_SIZE];
+	char interface_name[TOOLBOX_ROUTE_INTERFACE_SIZE];
+	unsigned int interface_index;
+	uint32_t table;
+	uint32_t metric;
+} defaultRoute_T;
+
+// fills up to max_routes default routes having a gateway, main table first then lowest metric.
+// family is TOOLBOX_ROUTE_ANY, TOOLBOX_ROUTE_IPV4 or TOOLBOX_ROUTE_IPV6.
+// Returns the number of routes found (can be more than max_routes), or negative on error.
+int C_GetDefaultRoutes(defaultRoute_T * routes, int max_routes, int family);
+
+// gateway of the best default route of that family.
+// Returns 1 if found, -20 if no default route, -11 if gateway_bufsize is too small.
+int C_GetDefaultGatewayEx(char * gateway, int gateway_bufsize, int family);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
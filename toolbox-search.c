@@ -0,0 +1,548 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-search.c
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Substring search engine. See .h for details
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "toolbox-errors.h"
+#include "toolbox-search.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	include <emmintrin.h>
+#	define TOOLBOX_SEARCH_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#	include <arm_neon.h>
+#	define TOOLBOX_SEARCH_NEON 1
+#endif
+
+#if defined(_MSC_VER)
+#	include <intrin.h>
+static int toolbox_search_ctz(unsigned long long mask)
+{
+	unsigned long index;
+	_BitScanForward64(&index, mask);
+	return (int)index;
+}
+#else
+#	define toolbox_search_ctz(a) __builtin_ctzll(a)
+#endif
+
+#define TOOLBOX_SEARCH_PAGE_SIZE 4096 // smallest page size on our targets
+// true if 16 bytes can be loaded at p without crossing into the next page
+#define TOOLBOX_SEARCH_LOAD16_IS_SAFE(p) ( ((size_t)(p) & (TOOLBOX_SEARCH_PAGE_SIZE-1)) <= TOOLBOX_SEARCH_PAGE_SIZE-16 )
+// such loads may read past the '\0' inside the page, keep address sanitizer quiet about it
+#if defined(__GNUC__) || defined(__clang__)
+#	define TOOLBOX_SEARCH_PAGE_LOADS __attribute__((no_sanitize_address))
+#else
+#	define TOOLBOX_SEARCH_PAGE_LOADS
+#endif
+
+const unsigned char g_toolbox_ascii_lower[256] =
+{
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+	0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+	0x40, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+	0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F,
+	0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+	0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F,
+	0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F,
+	0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F,
+	0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF,
+	0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+	0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF,
+	0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF,
+	0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0xED, 0xEE, 0xEF,
+	0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF
+};
+
+const unsigned char g_toolbox_ascii_upper[256] =
+{
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+	0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+	0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
+	0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F,
+	0x60, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
+	0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F,
+	0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F,
+	0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F,
+	0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF,
+	0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+	0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF,
+	0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF,
+	0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0xED, 0xEE, 0xEF,
+	0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF
+};
+
+
+// first/last byte filter for 2 <= needle_length <= TOOLBOX_SEARCH_SHORT_NEEDLE
+static const unsigned char * search_short(const unsigned char * haystack, size_t haystack_length, const unsigned char * needle, size_t needle_length)
+{
+	const unsigned char first = needle[0];
+	const unsigned char last = needle[needle_length-1];
+	const size_t positions = haystack_length - needle_length + 1; // candidate start offsets
+	size_t i = 0;
+
+#if defined(TOOLBOX_SEARCH_SSE2)
+	const __m128i vfirst = _mm_set1_epi8((char)first);
+	const __m128i vlast = _mm_set1_epi8((char)last);
+
+	// block i covers starts [i, i+16), last byte load ends at i+16+needle_length-1 <= haystack_length
+	for (; i + 16 <= positions; i += 16)
+	{
+		const __m128i blockFirst = _mm_loadu_si128((const __m128i*)(haystack + i));
+		const __m128i blockLast = _mm_loadu_si128((const __m128i*)(haystack + i + needle_length - 1));
+		unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(blockFirst, vfirst), _mm_cmpeq_epi8(blockLast, vlast)));
+
+		while ( mask )
+		{
+			const size_t candidate = i + toolbox_search_ctz(mask);
+			if ( memcmp(haystack + candidate + 1, needle + 1, needle_length - 2) == 0 )
+			{
+				return haystack + candidate;
+			}
+			mask &= mask - 1;
+		}
+	}
+#elif defined(TOOLBOX_SEARCH_NEON)
+	const uint8x16_t vfirst = vdupq_n_u8(first);
+	const uint8x16_t vlast = vdupq_n_u8(last);
+
+	for (; i + 16 <= positions; i += 16)
+	{
+		const uint8x16_t blockFirst = vld1q_u8(haystack + i);
+		const uint8x16_t blockLast = vld1q_u8(haystack + i + needle_length - 1);
+		const uint8x16_t eq = vandq_u8(vceqq_u8(blockFirst, vfirst), vceqq_u8(blockLast, vlast));
+		// narrow to 4 bits per byte, NEON has no movemask
+		uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+
+		mask &= 0x8888888888888888ULL;
+		while ( mask )
+		{
+			const size_t candidate = i + (toolbox_search_ctz(mask) >> 2);
+			if ( memcmp(haystack + candidate + 1, needle + 1, needle_length - 2) == 0 )
+			{
+				return haystack + candidate;
+			}
+			mask &= mask - 1;
+		}
+	}
+#endif
+
+	// scalar tail, or whole haystack without SIMD
+	while ( i < positions )
+	{
+		const unsigned char * strRet = (const unsigned char*)memchr(haystack + i, first, positions - i);
+		if ( strRet == NULL )
+		{
+			return NULL;
+		}
+		i = strRet - haystack;
+		if ( haystack[i + needle_length - 1] == last
+		  && memcmp(haystack + i + 1, needle + 1, needle_length - 2) == 0 )
+		{
+			return haystack + i;
+		}
+		i++;
+	}
+
+	return NULL;
+}
+
+// Boyer-Moore-Horspool for long needles
+static const unsigned char * search_horspool(const unsigned char * haystack, size_t haystack_length, const unsigned char * needle, size_t needle_length)
+{
+	size_t skip[256];
+	const size_t last = needle_length - 1;
+	size_t i;
+
+	for (i=0; i<256; i++)
+	{
+		skip[i] = needle_length;
+	}
+	for (i=0; i<last; i++)
+	{
+		skip[needle[i]] = last - i;
+	}
+
+	i = 0;
+	while ( i <= haystack_length - needle_length )
+	{
+		const unsigned char tail = haystack[i + last];
+		if ( tail == needle[last]
+		  && haystack[i] == needle[0]
+		  && memcmp(haystack + i, needle, last) == 0 )
+		{
+			return haystack + i;
+		}
+		i += skip[tail];
+	}
+
+	return NULL;
+}
+
+// written 19.Oct.2026
+const unsigned char * C_memSearch(const unsigned char * haystack, size_t haystack_length, const unsigned char * needle, size_t needle_length)
+{
+	if ( haystack == NULL || needle == NULL )
+	{
+		return NULL;
+	}
+	if ( needle_length == 0 )
+	{
+		return haystack;
+	}
+	if ( needle_length > haystack_length )
+	{
+		return NULL;
+	}
+	if ( needle_length == 1 )
+	{
+		return (const unsigned char*)memchr(haystack, needle[0], haystack_length);
+	}
+	if ( needle_length <= TOOLBOX_SEARCH_SHORT_NEEDLE )
+	{
+		return search_short(haystack, haystack_length, needle, needle_length);
+	}
+	return search_horspool(haystack, haystack_length, needle, needle_length);
+}
+
+
+#if defined(TOOLBOX_SEARCH_SSE2)
+// adds delta to the bytes in [first, first+26), 16 bytes at once
+static __m128i search_map16(__m128i block, unsigned char first, unsigned char delta)
+{
+	// shift the range to the bottom of the signed range so one compare finds it
+	const __m128i shifted = _mm_add_epi8(block, _mm_set1_epi8((char)(0x80 - first)));
+	const __m128i inRange = _mm_cmplt_epi8(shifted, _mm_set1_epi8((char)(0x80 + 26)));
+	return _mm_add_epi8(block, _mm_and_si128(inRange, _mm_set1_epi8((char)delta)));
+}
+#elif defined(TOOLBOX_SEARCH_NEON)
+static uint8x16_t search_map16(uint8x16_t block, unsigned char first, unsigned char delta)
+{
+	const uint8x16_t inRange = vcleq_u8(vsubq_u8(block, vdupq_n_u8(first)), vdupq_n_u8(25));
+	return vaddq_u8(block, vandq_u8(inRange, vdupq_n_u8(delta)));
+}
+#endif
+// 'A'-'Z' to 'a'-'z'
+#define search_fold16(block) search_map16(block, 'A', 0x20)
+
+// length bytes of source to destination, which may be source.
+// 32 bytes per step, then 16, then the table for the tail.
+static void search_caseMap(unsigned char * destination, const unsigned char * source, size_t length, int upper)
+{
+	const unsigned char * table = upper ? g_toolbox_ascii_upper : g_toolbox_ascii_lower;
+	size_t i = 0;
+
+#if defined(TOOLBOX_SEARCH_SSE2) || defined(TOOLBOX_SEARCH_NEON)
+	const unsigned char first = upper ? 'a' : 'A';
+	const unsigned char delta = upper ? (unsigned char)0xE0 : 0x20; // -0x20 or +0x20
+#endif
+
+#if defined(TOOLBOX_SEARCH_SSE2)
+	for (; i + 32 <= length; i += 32)
+	{
+		const __m128i low = search_map16(_mm_loadu_si128((const __m128i*)(source + i)), first, delta);
+		const __m128i high = search_map16(_mm_loadu_si128((const __m128i*)(source + i + 16)), first, delta);
+		_mm_storeu_si128((__m128i*)(destination + i), low);
+		_mm_storeu_si128((__m128i*)(destination + i + 16), high);
+	}
+	if ( i + 16 <= length )
+	{
+		_mm_storeu_si128((__m128i*)(destination + i), search_map16(_mm_loadu_si128((const __m128i*)(source + i)), first, delta));
+		i += 16;
+	}
+#elif defined(TOOLBOX_SEARCH_NEON)
+	for (; i + 32 <= length; i += 32)
+	{
+		const uint8x16_t low = search_map16(vld1q_u8(source + i), first, delta);
+		const uint8x16_t high = search_map16(vld1q_u8(source + i + 16), first, delta);
+		vst1q_u8(destination + i, low);
+		vst1q_u8(destination + i + 16, high);
+	}
+	if ( i + 16 <= length )
+	{
+		vst1q_u8(destination + i, search_map16(vld1q_u8(source + i), first, delta));
+		i += 16;
+	}
+#endif
+	for (; i < length; i++)
+	{
+		destination[i] = table[source[i]];
+	}
+}
+
+// written 19.Oct.2026
+int C_asciiToLower(char * text, size_t length)
+{
+	if ( text == NULL )
+	{
+		return -1;
+	}
+	search_caseMap((unsigned char*)text, (const unsigned char*)text, length, 0);
+	return 1;
+}
+
+// written 19.Oct.2026
+int C_asciiToUpper(char * text, size_t length)
+{
+	if ( text == NULL )
+	{
+		return -1;
+	}
+	search_caseMap((unsigned char*)text, (const unsigned char*)text, length, 1);
+	return 1;
+}
+
+// written 19.Oct.2026
+int C_asciiToLowerCopy(char * destination, const char * source, size_t length)
+{
+	if ( destination == NULL )
+	{
+		return -1;
+	}
+	if ( source == NULL )
+	{
+		return -2;
+	}
+	search_caseMap((unsigned char*)destination, (const unsigned char*)source, length, 0);
+	return 1;
+}
+
+// written 19.Oct.2026
+int C_asciiToUpperCopy(char * destination, const char * source, size_t length)
+{
+	if ( destination == NULL )
+	{
+		return -1;
+	}
+	if ( source == NULL )
+	{
+		return -2;
+	}
+	search_caseMap((unsigned char*)destination, (const unsigned char*)source, length, 1);
+	return 1;
+}
+
+#define caseNeedle_Folded(a) ( (a)->buffer ? (a)->buffer : (a)->fixed )
+
+// written 19.Oct.2026
+int caseNeedle_Constructor(caseNeedle_T * caseNeedle, const char * needle, size_t needle_length)
+{
+	unsigned char * folded;
+
+	if ( caseNeedle == NULL )
+	{
+		return -1;
+	}
+	caseNeedle->buffer = NULL;
+	caseNeedle->length = 0;
+	if ( needle == NULL )
+	{
+		return -2;
+	}
+
+	folded = caseNeedle->fixed;
+	if ( needle_length > sizeof(caseNeedle->fixed) )
+	{
+		caseNeedle->buffer = (unsigned char*)malloc(needle_length);
+		if ( caseNeedle->buffer == NULL )
+		{
+			return TOOLBOX_ERROR_MALLOC;
+		}
+		folded = caseNeedle->buffer;
+	}
+
+	search_caseMap(folded, (const unsigned char*)needle, needle_length, 0);
+	caseNeedle->length = needle_length;
+
+	return 1;
+}
+
+int caseNeedle_Destructor(caseNeedle_T * caseNeedle)
+{
+	if ( caseNeedle == NULL )
+	{
+		return -1;
+	}
+	if ( caseNeedle->buffer )
+	{
+		free(caseNeedle->buffer);
+		caseNeedle->buffer = NULL;
+	}
+	caseNeedle->length = 0;
+	return 1;
+}
+
+// compares length bytes of haystack against an already folded needle
+static int search_caseEqual(const unsigned char * haystack, const unsigned char * folded, size_t length)
+{
+	size_t i;
+	for (i=0; i<length; i++)
+	{
+		if ( g_toolbox_ascii_lower[haystack[i]] != folded[i] )
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+// written 19.Oct.2026
+const unsigned char * C_memCaseSearch(const unsigned char * haystack, size_t haystack_length, const caseNeedle_T * caseNeedle)
+{
+	const unsigned char * folded;
+	size_t needle_length;
+	size_t positions;
+	size_t i = 0;
+
+	if ( haystack == NULL || caseNeedle == NULL )
+	{
+		return NULL;
+	}
+
+	folded = caseNeedle_Folded(caseNeedle);
+	needle_length = caseNeedle->length;
+	if ( needle_length == 0 )
+	{
+		return haystack;
+	}
+	if ( needle_length > haystack_length )
+	{
+		return NULL;
+	}
+	positions = haystack_length - needle_length + 1;
+
+#if defined(TOOLBOX_SEARCH_SSE2)
+	{
+		const __m128i vfirst = _mm_set1_epi8((char)folded[0]);
+		const __m128i vlast = _mm_set1_epi8((char)folded[needle_length-1]);
+
+		for (; i + 16 <= positions; i += 16)
+		{
+			const __m128i blockFirst = search_fold16(_mm_loadu_si128((const __m128i*)(haystack + i)));
+			const __m128i blockLast = search_fold16(_mm_loadu_si128((const __m128i*)(haystack + i + needle_length - 1)));
+			unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(blockFirst, vfirst), _mm_cmpeq_epi8(blockLast, vlast)));
+
+			while ( mask )
+			{
+				const size_t candidate = i + toolbox_search_ctz(mask);
+				if ( search_caseEqual(haystack + candidate + 1, folded + 1, needle_length - 1) )
+				{
+					return haystack + candidate;
+				}
+				mask &= mask - 1;
+			}
+		}
+	}
+#elif defined(TOOLBOX_SEARCH_NEON)
+	{
+		const uint8x16_t vfirst = vdupq_n_u8(folded[0]);
+		const uint8x16_t vlast = vdupq_n_u8(folded[needle_length-1]);
+
+		for (; i + 16 <= positions; i += 16)
+		{
+			const uint8x16_t blockFirst = search_fold16(vld1q_u8(haystack + i));
+			const uint8x16_t blockLast = search_fold16(vld1q_u8(haystack + i + needle_length - 1));
+			const uint8x16_t eq = vandq_u8(vceqq_u8(blockFirst, vfirst), vceqq_u8(blockLast, vlast));
+			uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+
+			mask &= 0x8888888888888888ULL;
+			while ( mask )
+			{
+				const size_t candidate = i + (toolbox_search_ctz(mask) >> 2);
+				if ( search_caseEqual(haystack + candidate + 1, folded + 1, needle_length - 1) )
+				{
+					return haystack + candidate;
+				}
+				mask &= mask - 1;
+			}
+		}
+	}
+#endif
+
+	for (; i < positions; i++)
+	{
+		if ( g_toolbox_ascii_lower[haystack[i]] == folded[0]
+		  && search_caseEqual(haystack + i + 1, folded + 1, needle_length - 1) )
+		{
+			return haystack + i;
+		}
+	}
+
+	return NULL;
+}
+
+// written 19.Oct.2026
+// 16 bytes are compared per step while neither string can cross a page in the load.
+TOOLBOX_SEARCH_PAGE_LOADS int C_strcasecmpAscii(const char * a, const char * b)
+{
+	const unsigned char * ua = (const unsigned char*)a;
+	const unsigned char * ub = (const unsigned char*)b;
+
+#if defined(TOOLBOX_SEARCH_SSE2)
+	while ( TOOLBOX_SEARCH_LOAD16_IS_SAFE(ua) && TOOLBOX_SEARCH_LOAD16_IS_SAFE(ub) )
+	{
+		const __m128i blockA = _mm_loadu_si128((const __m128i*)ua);
+		const __m128i blockB = _mm_loadu_si128((const __m128i*)ub);
+		const __m128i equal = _mm_cmpeq_epi8(search_fold16(blockA), search_fold16(blockB));
+		const __m128i zero = _mm_cmpeq_epi8(blockA, _mm_setzero_si128());
+		// stop on first difference or end of a
+		const unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_andnot_si128(equal, _mm_set1_epi8(-1))) | (unsigned int)_mm_movemask_epi8(zero);
+		if ( mask )
+		{
+			const int index = toolbox_search_ctz(mask);
+			return (int)g_toolbox_ascii_lower[ua[index]] - (int)g_toolbox_ascii_lower[ub[index]];
+		}
+		ua += 16;
+		ub += 16;
+	}
+#elif defined(TOOLBOX_SEARCH_NEON)
+	while ( TOOLBOX_SEARCH_LOAD16_IS_SAFE(ua) && TOOLBOX_SEARCH_LOAD16_IS_SAFE(ub) )
+	{
+		const uint8x16_t blockA = vld1q_u8(ua);
+		const uint8x16_t blockB = vld1q_u8(ub);
+		const uint8x16_t equal = vceqq_u8(search_fold16(blockA), search_fold16(blockB));
+		const uint8x16_t stop = vorrq_u8(vmvnq_u8(equal), vceqq_u8(blockA, vdupq_n_u8(0)));
+		uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(stop), 4)), 0);
+		if ( mask )
+		{
+			const int index = toolbox_search_ctz(mask) >> 2;
+			return (int)g_toolbox_ascii_lower[ua[index]] - (int)g_toolbox_ascii_lower[ub[index]];
+		}
+		ua += 16;
+		ub += 16;
+	}
+#endif
+
+	while ( 1 )
+	{
+		const int fa = g_toolbox_ascii_lower[*ua];
+		const int fb = g_toolbox_ascii_lower[*ub];
+		if ( fa != fb || fa == 0 )
+		{
+			return fa - fb;
+		}
+		ua++;
+		ub++;
+	}
+}
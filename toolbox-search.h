@@ -0,0 +1,82 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-search.h
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Substring search engine used by C_memfind and C_memFind.
+//      Needles of one byte go to memchr. Short needles are filtered 16 bytes
+//      at a time on their first and last byte (SSE2 or NEON when the compiler
+//      targets them, plain scalar otherwise) and only candidates are compared.
+//      Long needles use Boyer-Moore-Horspool.
+//
+//      Case-insensitive variants fold ASCII only ('A'-'Z'), like strcasecmp in
+//      the C locale. A caseNeedle_T holds a needle folded once so it can be
+//      searched in many haystacks.
+//      C_asciiToLower/Upper map a known length 32 bytes per step, so keys can
+//      be folded once before they are compared or sorted.
+//
+//      Never reads outside [haystack, haystack+haystack_length).
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef __C_TOOLBOX_SEARCH_H__
+#define __C_TOOLBOX_SEARCH_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+// needles up to this length use the first/last byte filter, longer ones use Horspool
+#define TOOLBOX_SEARCH_SHORT_NEEDLE 32
+// prepared needles up to this length are folded without malloc
+#define TOOLBOX_CASE_NEEDLE_FIXED 64
+
+// ASCII lower and upper case tables, other bytes map to themselves
+extern const unsigned char g_toolbox_ascii_lower[256];
+extern const unsigned char g_toolbox_ascii_upper[256];
+
+typedef struct caseNeedle_S
+{
+	unsigned char fixed[TOOLBOX_CASE_NEEDLE_FIXED];
+	unsigned char * buffer; // used if fixed is not big enough
+	size_t length;
+} caseNeedle_T;
+
+// returns pointer to first occurrence of needle in haystack, or NULL.
+// an empty needle matches at haystack.
+const unsigned char * C_memSearch(const unsigned char * haystack, size_t haystack_length, const unsigned char * needle, size_t needle_length);
+
+// needle does not need to be terminated
+int caseNeedle_Constructor(caseNeedle_T * caseNeedle, const char * needle, size_t needle_length);
+int caseNeedle_Destructor(caseNeedle_T * caseNeedle);
+
+// case-insensitive C_memSearch with a prepared needle
+const unsigned char * C_memCaseSearch(const unsigned char * haystack, size_t haystack_length, const caseNeedle_T * caseNeedle);
+
+// ASCII strcasecmp, same ordering as strcasecmp in the C locale
+int C_strcasecmpAscii(const char * a, const char * b);
+
+// ASCII case mapping of length bytes, '\0' is not special and none is added.
+// Copy variants accept destination == source.
+int C_asciiToLower(char * text, size_t length);
+int C_asciiToUpper(char * text, size_t length);
+int C_asciiToLowerCopy(char * destination, const char * source, size_t length);
+int C_asciiToUpperCopy(char * destination, const char * source, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,424 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-timing.c
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Monotonic clock and per-thread latency histograms, see toolbox-timing.h
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "toolbox-errors.h"
+#include "toolbox-timing.h"
+
+#if defined(_MSC_VER)
+#	include <windows.h>
+#	define TIMING_THREAD_LOCAL __declspec(thread)
+#else
+#	include <time.h>
+#	include <pthread.h>
+#	define TIMING_THREAD_LOCAL __thread
+#endif
+
+typedef struct timingHistogram_S
+{
+	uint64_t count;
+	uint64_t total_ns;
+	uint64_t min_ns;
+	uint64_t max_ns;
+	uint64_t buckets[TOOLBOX_TIMING_BUCKETS];
+} timingHistogram_T;
+
+typedef struct timingThread_S
+{
+	struct timingThread_S * next;
+	int in_use; // 0 once its thread exited, a new thread can take it over
+	timingHistogram_T points[TOOLBOX_TIMING_MAX_POINTS];
+} timingThread_T;
+
+static const char * g_timing_names[TOOLBOX_TIMING_MAX_POINTS];
+static int g_timing_point_count = 0; // never above TOOLBOX_TIMING_MAX_POINTS
+static char g_timing_register_lock = 0;
+
+// point_cache values besides a point index
+#define TIMING_POINT_UNKNOWN -1 // not registered yet
+#define TIMING_POINT_FULL -2 // every point was taken, the call site is not recorded
+static timingThread_T * g_timing_threads = NULL; // every thread that recorded, newest first
+static TIMING_THREAD_LOCAL timingThread_T * t_timing_thread = NULL;
+// only used for its destructor, which gives the block back when the thread exits
+#if defined(_MSC_VER)
+static INIT_ONCE g_timing_key_once = INIT_ONCE_STATIC_INIT;
+static DWORD g_timing_key = FLS_OUT_OF_INDEXES;
+#else
+static pthread_once_t g_timing_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t g_timing_key;
+static int g_timing_key_valid = 0;
+#endif
+
+uint64_t C_MonotonicNs(void)
+{
+#if defined(_MSC_VER)
+	static LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+	if ( frequency.QuadPart == 0 )
+	{
+		QueryPerformanceFrequency(&frequency);
+	}
+	QueryPerformanceCounter(&counter);
+	return (uint64_t)(counter.QuadPart / frequency.QuadPart) * 1000000000ULL
+	     + (uint64_t)(counter.QuadPart % frequency.QuadPart) * 1000000000ULL / (uint64_t)frequency.QuadPart;
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+#endif
+}
+
+// values below 8 get their own bucket, then 8 buckets per power of two
+static unsigned int timing_bucket(uint64_t value)
+{
+	unsigned int exponent;
+
+	if ( value < (1 << TOOLBOX_TIMING_SUB_BUCKET_BITS) )
+	{
+		return (unsigned int)value;
+	}
+#if defined(__GNUC__)
+	exponent = 63 - (unsigned int)__builtin_clzll(value);
+#else
+	exponent = 0;
+	while ( (value >> exponent) > 1 ) exponent++;
+#endif
+	return ((exponent - TOOLBOX_TIMING_SUB_BUCKET_BITS + 1) << TOOLBOX_TIMING_SUB_BUCKET_BITS)
+	     + (unsigned int)((value >> (exponent - TOOLBOX_TIMING_SUB_BUCKET_BITS)) & ((1 << TOOLBOX_TIMING_SUB_BUCKET_BITS) - 1));
+}
+
+// upper bound of the values counted in bucket
+static uint64_t timing_bucketValue(unsigned int bucket)
+{
+	unsigned int group = bucket >> TOOLBOX_TIMING_SUB_BUCKET_BITS;
+	uint64_t sub = bucket & ((1 << TOOLBOX_TIMING_SUB_BUCKET_BITS) - 1);
+	unsigned int exponent;
+
+	if ( group == 0 )
+	{
+		return sub;
+	}
+	exponent = group + TOOLBOX_TIMING_SUB_BUCKET_BITS - 1;
+	return (((uint64_t)(1 << TOOLBOX_TIMING_SUB_BUCKET_BITS) + sub + 1) << (exponent - TOOLBOX_TIMING_SUB_BUCKET_BITS)) - 1;
+}
+
+// Modified 19.Oct.2026, registrations are serialized so a race does not use a
+// second slot, and a call site is told once that all slots are taken
+static int timing_registerPoint(int * point_cache, const char * name)
+{
+	int point;
+	int count;
+	int i;
+
+	// only the first measure of each call site gets here, a spin lock is enough
+	while ( __atomic_test_and_set(&g_timing_register_lock, __ATOMIC_ACQUIRE) )
+	{
+	}
+
+	point = __atomic_load_n(point_cache, __ATOMIC_ACQUIRE);
+	if ( point != TIMING_POINT_UNKNOWN )
+	{
+		goto end_of_func; // another thread registered this call site first
+	}
+
+	// same name used from several places shares one point
+	count = __atomic_load_n(&g_timing_point_count, __ATOMIC_ACQUIRE);
+	for (i = 0; i < count; i++)
+	{
+		if ( strcmp(g_timing_names[i], name) == 0 )
+		{
+			point = i;
+			goto end_of_func;
+		}
+	}
+
+	if ( count >= TOOLBOX_TIMING_MAX_POINTS )
+	{
+		point = TIMING_POINT_FULL;
+		goto end_of_func;
+	}
+	point = count;
+	__atomic_store_n(&g_timing_names[point], name, __ATOMIC_RELEASE);
+	__atomic_store_n(&g_timing_point_count, count + 1, __ATOMIC_RELEASE); // name is set before it is counted
+
+end_of_func:
+	__atomic_store_n(point_cache, point, __ATOMIC_RELEASE);
+	__atomic_clear(&g_timing_register_lock, __ATOMIC_RELEASE);
+	return point;
+}
+
+#if defined(_MSC_VER)
+static VOID WINAPI timing_threadExit(PVOID value)
+#else
+static void timing_threadExit(void * value)
+#endif
+{
+	timingThread_T * block = (timingThread_T*)value;
+	if ( block )
+	{
+		// its histograms stay on the list, the next owner adds to them
+		__atomic_store_n(&block->in_use, 0, __ATOMIC_RELEASE);
+	}
+}
+
+#if defined(_MSC_VER)
+static BOOL CALLBACK timing_keyCreate(PINIT_ONCE once, PVOID parameter, PVOID * context)
+{
+	g_timing_key = FlsAlloc(timing_threadExit);
+	return TRUE;
+}
+#else
+static void timing_keyCreate(void)
+{
+	g_timing_key_valid = (pthread_key_create(&g_timing_key, timing_threadExit) == 0);
+}
+#endif
+
+// Modified 19.Oct.2026, takes over the block of an exited thread before allocating one
+static timingThread_T * timing_thread(void)
+{
+	timingThread_T * block = t_timing_thread;
+	int expected;
+
+	if ( block )
+	{
+		return block;
+	}
+
+	for (block = __atomic_load_n(&g_timing_threads, __ATOMIC_ACQUIRE); block; block = block->next)
+	{
+		expected = 0;
+		if ( __atomic_load_n(&block->in_use, __ATOMIC_RELAXED) == 0
+		  && __atomic_compare_exchange_n(&block->in_use, &expected, 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) )
+		{
+			break;
+		}
+	}
+	if ( block == NULL )
+	{
+		block = (timingThread_T*)calloc(1, sizeof(timingThread_T));
+		if ( block == NULL )
+		{
+			return NULL;
+		}
+		block->in_use = 1;
+		block->next = __atomic_load_n(&g_timing_threads, __ATOMIC_RELAXED);
+		while ( __atomic_compare_exchange_n(&g_timing_threads, &block->next, block, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED) == 0 )
+		{
+		}
+	}
+
+#if defined(_MSC_VER)
+	InitOnceExecuteOnce(&g_timing_key_once, timing_keyCreate, NULL, NULL);
+	if ( g_timing_key != FLS_OUT_OF_INDEXES )
+	{
+		FlsSetValue(g_timing_key, block);
+	}
+#else
+	pthread_once(&g_timing_key_once, timing_keyCreate);
+	if ( g_timing_key_valid )
+	{
+		pthread_setspecific(g_timing_key, block);
+	}
+#endif
+	t_timing_thread = block;
+	return block;
+}
+
+// written 19.Oct.2026
+void C_TimingRecord(int * point_cache, const char * name, uint64_t elapsed_ns)
+{
+	timingThread_T * block;
+	timingHistogram_T * histogram;
+	unsigned int bucket;
+	int point;
+
+	if ( point_cache == NULL || name == NULL )
+	{
+		return;
+	}
+	point = __atomic_load_n(point_cache, __ATOMIC_ACQUIRE);
+	if ( point == TIMING_POINT_UNKNOWN )
+	{
+		point = timing_registerPoint(point_cache, name);
+	}
+	if ( point < 0 )
+	{
+		return; // too many points
+	}
+	block = timing_thread();
+	if ( block == NULL )
+	{
+		return;
+	}
+
+	// only this thread writes here, relaxed stores are enough for the reader
+	histogram = &block->points[point];
+	bucket = timing_bucket(elapsed_ns);
+	if ( histogram->count == 0 || elapsed_ns < histogram->min_ns )
+	{
+		__atomic_store_n(&histogram->min_ns, elapsed_ns, __ATOMIC_RELAXED);
+	}
+	if ( elapsed_ns > histogram->max_ns )
+	{
+		__atomic_store_n(&histogram->max_ns, elapsed_ns, __ATOMIC_RELAXED);
+	}
+	__atomic_store_n(&histogram->buckets[bucket], histogram->buckets[bucket] + 1, __ATOMIC_RELAXED);
+	__atomic_store_n(&histogram->total_ns, histogram->total_ns + elapsed_ns, __ATOMIC_RELAXED);
+	__atomic_store_n(&histogram->count, histogram->count + 1, __ATOMIC_RELAXED);
+}
+
+void C_TimingScopeEnd(timingScope_T * scope)
+{
+	C_TimingRecord(scope->point_cache, scope->name, C_MonotonicNs() - scope->start_ns);
+}
+
+static uint64_t timing_percentile(const uint64_t * buckets, uint64_t count, unsigned int percent)
+{
+	uint64_t wanted = (count * percent + 99) / 100;
+	uint64_t seen = 0;
+	unsigned int i;
+
+	for (i = 0; i < TOOLBOX_TIMING_BUCKETS; i++)
+	{
+		seen += buckets[i];
+		if ( seen >= wanted && seen > 0 )
+		{
+			return timing_bucketValue(i);
+		}
+	}
+	return 0;
+}
+
+// bucket bounds are coarser than the exact min and max
+static uint64_t timing_clamp(uint64_t value, const timingStats_T * stats)
+{
+	if ( value < stats->min_ns ) return stats->min_ns;
+	if ( value > stats->max_ns ) return stats->max_ns;
+	return value;
+}
+
+// written 19.Oct.2026
+int C_TimingSnapshot(timingStats_T * stats, int max_stats)
+{
+	uint64_t * buckets;
+	timingThread_T * block;
+	int count;
+	int point;
+	uint64_t total;
+	int written = 0;
+	unsigned int i;
+
+	if ( stats == NULL )
+	{
+		return -1;
+	}
+
+	buckets = (uint64_t*)malloc(TOOLBOX_TIMING_BUCKETS * sizeof(uint64_t));
+	if ( buckets == NULL )
+	{
+		return TOOLBOX_ERROR_MALLOC;
+	}
+
+	count = __atomic_load_n(&g_timing_point_count, __ATOMIC_ACQUIRE);
+	if ( count > TOOLBOX_TIMING_MAX_POINTS )
+	{
+		count = TOOLBOX_TIMING_MAX_POINTS;
+	}
+
+	for (point = 0; point < count && written < max_stats; point++)
+	{
+		timingStats_T * merged = &stats[written];
+
+		memset(merged, 0, sizeof(timingStats_T));
+		memset(buckets, 0, TOOLBOX_TIMING_BUCKETS * sizeof(uint64_t));
+		merged->name = __atomic_load_n(&g_timing_names[point], __ATOMIC_ACQUIRE);
+
+		for (block = __atomic_load_n(&g_timing_threads, __ATOMIC_ACQUIRE); block; block = block->next)
+		{
+			timingHistogram_T * histogram = &block->points[point];
+			uint64_t thread_count = __atomic_load_n(&histogram->count, __ATOMIC_RELAXED);
+			uint64_t value;
+			if ( thread_count == 0 )
+			{
+				continue;
+			}
+			merged->count += thread_count;
+			merged->total_ns += __atomic_load_n(&histogram->total_ns, __ATOMIC_RELAXED);
+			value = __atomic_load_n(&histogram->min_ns, __ATOMIC_RELAXED);
+			if ( merged->count == thread_count || value < merged->min_ns ) merged->min_ns = value; // first thread or smaller
+			value = __atomic_load_n(&histogram->max_ns, __ATOMIC_RELAXED);
+			if ( value > merged->max_ns ) merged->max_ns = value;
+			for (i = 0; i < TOOLBOX_TIMING_BUCKETS; i++)
+			{
+				buckets[i] += __atomic_load_n(&histogram->buckets[i], __ATOMIC_RELAXED);
+			}
+		}
+		if ( merged->name == NULL || merged->count == 0 )
+		{
+			continue;
+		}
+
+		// count may be ahead of buckets while a thread records, percentiles use the bucket sum
+		total = 0;
+		for (i = 0; i < TOOLBOX_TIMING_BUCKETS; i++)
+		{
+			total += buckets[i];
+		}
+		merged->p50_ns = timing_clamp(timing_percentile(buckets, total, 50), merged);
+		merged->p90_ns = timing_clamp(timing_percentile(buckets, total, 90), merged);
+		merged->p99_ns = timing_clamp(timing_percentile(buckets, total, 99), merged);
+		written++;
+	}
+
+	free(buckets);
+	return written;
+}
+
+// written 19.Oct.2026
+int C_TimingPrint(FILE * output)
+{
+	timingStats_T stats[TOOLBOX_TIMING_MAX_POINTS];
+	int count;
+	int i;
+
+	if ( output == NULL )
+	{
+		return -1;
+	}
+
+	count = C_TimingSnapshot(stats, TOOLBOX_TIMING_MAX_POINTS);
+	if ( count < 0 )
+	{
+		return count;
+	}
+	fprintf(output, "# name count total_ns min_ns p50_ns p90_ns p99_ns max_ns\n");
+	for (i = 0; i < count; i++)
+	{
+		fprintf(output, "%s %llu %llu %llu %llu %llu %llu %llu\n", stats[i].name,
+			(unsigned long long)stats[i].count, (unsigned long long)stats[i].total_ns,
+			(unsigned long long)stats[i].min_ns, (unsigned long long)stats[i].p50_ns,
+			(unsigned long long)stats[i].p90_ns, (unsigned long long)stats[i].p99_ns,
+			(unsigned long long)stats[i].max_ns);
+	}
+	return count;
+}
@@ -0,0 +1,100 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-timing.h
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Monotonic nanosecond clock and latency histograms for field profiling.
+//
+//      TOOLBOX_TIMING_SCOPE("name") at the top of a block records the time
+//      spent until the block is left, whatever the return path.
+//      Each thread records in its own histograms, no lock or shared cache
+//      line on the hot path. C_TimingSnapshot() merges all threads on read.
+//
+//      Histograms are log-linear: 8 linear sub-buckets per power of two,
+//      so any percentile is within 12.5% of the real value.
+//
+//  Limitations:
+//      At most TOOLBOX_TIMING_MAX_POINTS distinct names.
+//      A thread that exits gives its histograms back, the next thread that
+//      records takes them over and adds to them: counts of exited threads are
+//      still reported and memory is bounded by the threads recording at once.
+//      TOOLBOX_TIMING_SCOPE needs gcc or clang (cleanup attribute), it
+//      compiles to nothing elsewhere.
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef __C_TOOLBOX_TIMING_H__
+#define __C_TOOLBOX_TIMING_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdio.h>
+#include "toolbox-config.h"
+#include "toolbox-basic-types.h"
+
+#define TOOLBOX_TIMING_MAX_POINTS 16
+#define TOOLBOX_TIMING_SUB_BUCKET_BITS 3
+#define TOOLBOX_TIMING_BUCKETS (64 << TOOLBOX_TIMING_SUB_BUCKET_BITS)
+
+typedef struct timingStats_S
+{
+	const char * name;
+	uint64_t count;
+	uint64_t total_ns;
+	uint64_t min_ns;
+	uint64_t max_ns;
+	uint64_t p50_ns;
+	uint64_t p90_ns;
+	uint64_t p99_ns;
+} timingStats_T;
+
+// CLOCK_MONOTONIC, does not jump with NTP or date changes
+uint64_t C_MonotonicNs(void);
+
+// adds one measure to the histogram of name.
+// point_cache must be a static int initialized to -1, it saves the name lookup.
+void C_TimingRecord(int * point_cache, const char * name, uint64_t elapsed_ns);
+
+// merges every thread. Returns the number of points written in stats.
+int C_TimingSnapshot(timingStats_T * stats, int max_stats);
+
+// one line per point: name count total_ns min_ns p50_ns p90_ns p99_ns max_ns
+int C_TimingPrint(FILE * output);
+
+typedef struct timingScope_S
+{
+	int * point_cache;
+	const char * name;
+	uint64_t start_ns;
+} timingScope_T;
+
+void C_TimingScopeEnd(timingScope_T * scope);
+
+#if C_TOOLBOX_TIMING_INSTRUMENTATION == 1 && defined(__GNUC__)
+#	define TOOLBOX_TIMING_CONCAT_(a, b) a##b
+#	define TOOLBOX_TIMING_CONCAT(a, b) TOOLBOX_TIMING_CONCAT_(a, b)
+#	define TOOLBOX_TIMING_SCOPE(name) \
+		static int TOOLBOX_TIMING_CONCAT(toolbox_timing_point_, __LINE__) = -1; \
+		timingScope_T TOOLBOX_TIMING_CONCAT(toolbox_timing_scope_, __LINE__) __attribute__((cleanup(C_TimingScopeEnd))) = \
+			{ &TOOLBOX_TIMING_CONCAT(toolbox_timing_point_, __LINE__), (name), C_MonotonicNs() }
+#else
+#	define TOOLBOX_TIMING_SCOPE(name)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,656 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-tree-snapshot.c
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Save a genericTree_T to disk and map it back. See .h for the layout.
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include "toolbox.h"
+
+#if C_TOOLBOX_GENERIC_TREE_SNAPSHOT == 1
+#	include "toolbox-tree.h"
+#	include "toolbox-tree-snapshot.h"
+#	include "toolbox-errors.h"
+#	include "toolbox-basic-types.h"
+
+#	include <stdio.h>
+#	include <string.h>
+#	include <stdlib.h>
+
+#	if !defined(_MSC_VER)
+#		include <fcntl.h>
+#		include <unistd.h>
+#		include <sys/mman.h>
+#		include <sys/stat.h>
+#	endif
+
+#define TREE_SNAPSHOT_ALIGN(a) ( ((a) + 7) & ~((uint64_t)7) )
+
+static uint32_t treeSnapshot_checksum(const unsigned char * data, uint64_t length)
+{
+	uint32_t hash = 2166136261u;
+	uint64_t i;
+
+	for (i=0; i<length; i++)
+	{
+		hash ^= data[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+// written 19.Oct.2026
+int genericTree_SaveSnapshot(genericTree_T * genericTree, const char * filename, int clients_are_file_entries)
+{
+#if defined(_MSC_VER)
+	return TOOLBOX_ERROR_NOT_SUPPORTED;
+#else
+	treeItem_T ** items = NULL; // breadth-first order, also used as the queue
+	treeSnapshotNode_T * nodes = NULL;
+	treeSnapshotEntry_T * entries = NULL;
+	unsigned char * image = NULL;
+	treeSnapshotHeader_T * header;
+	treeItem_T * child;
+	char tmpFilename[512];
+	FILE * file;
+	uint32_t count = 1;
+	uint32_t capacity;
+	uint32_t entry_count = 0;
+	uint32_t i;
+	uint32_t first;
+	uint64_t strings_size = 0;
+	uint64_t offset;
+	uint64_t image_size;
+	size_t length;
+	int locked;
+	int fret = 1;
+
+	if ( genericTree == NULL )
+	{
+		return -1;
+	}
+	if ( genericTree->should_always_be_0xAFAF7878 != (int)0xAFAF7878 )
+	{
+		return TOOLBOX_ERROR_NOT_INITIALIZED_OR_GOT_CORRUPTED;
+	}
+	if ( filename == NULL )
+	{
+		return -2;
+	}
+	if ( strlen(filename) + 5 > sizeof(tmpFilename) )
+	{
+		return TOOLBOX_ERROR_YOU_PASSED_A_FILENAME_TOO_BIG;
+	}
+
+	// the tree is only read until the image is built, not while it is written to disk
+	genericTree_ReadLock(genericTree);
+	locked = 1;
+	capacity = (uint32_t)genericTree->itemAmount + 1;
+	items = (treeItem_T**)malloc(sizeof(treeItem_T*) * capacity);
+	if ( items == NULL )
+	{
+		genericTree_ReadUnlock(genericTree);
+		return TOOLBOX_ERROR_MALLOC;
+	}
+
+	// flatten, the childs of items[i] are appended in their sorted order
+	items[0] = &genericTree->top;
+	for (i=0; i<count; i++)
+	{
+		for (child = items[i]->childs; child != NULL; child = child->next)
+		{
+			if ( count == capacity )
+			{
+				treeItem_T ** grown = (treeItem_T**)realloc(items, sizeof(treeItem_T*) * capacity * 2);
+				if ( grown == NULL )
+				{
+					fret = TOOLBOX_ERROR_MALLOC;
+					goto end_of_save;
+				}
+				items = grown;
+				capacity *= 2;
+			}
+			items[count++] = child;
+		}
+	}
+
+	nodes = (treeSnapshotNode_T*)calloc(count, sizeof(treeSnapshotNode_T));
+	if ( clients_are_file_entries )
+	{
+		entries = (treeSnapshotEntry_T*)calloc(count, sizeof(treeSnapshotEntry_T));
+	}
+	if ( nodes == NULL || (clients_are_file_entries && entries == NULL) )
+	{
+		fret = TOOLBOX_ERROR_MALLOC;
+		goto end_of_save;
+	}
+
+	for (i=0; i<count; i++)
+	{
+		nodes[i].parent = TREE_SNAPSHOT_NONE;
+		nodes[i].childs = TREE_SNAPSHOT_NONE;
+		nodes[i].next = TREE_SNAPSHOT_NONE;
+		nodes[i].prev = TREE_SNAPSHOT_NONE;
+		nodes[i].entry = TREE_SNAPSHOT_NONE;
+	}
+
+	// second sweep gives the same order, so links can be resolved by position
+	first = 1;
+	for (i=0; i<count; i++)
+	{
+		uint32_t k = first;
+
+		length = flexstrlen(&items[i]->name);
+		nodes[i].name_offset = (uint32_t)strings_size;
+		nodes[i].name_length = (uint32_t)length;
+		nodes[i].unique_id = items[i]->unique_id;
+		nodes[i].flags = items[i]->flags;
+		strings_size += length + 1;
+		if ( strings_size > 0xFFFFFFFFu )
+		{
+			fret = TOOLBOX_ERROR_OUT_OF_RANGE;
+			goto end_of_save;
+		}
+
+		if ( entries && items[i]->client )
+		{
+			const fileEntry_T * entry = (const fileEntry_T*)items[i]->client;
+			entries[entry_count].ctime = (int64_t)entry->ctime;
+			entries[entry_count].mtime = (int64_t)entry->mtime;
+			entries[entry_count].size = entry->size;
+			entries[entry_count].isDirectory = (uint32_t)entry->isDirectory;
+			nodes[i].entry = entry_count++;
+		}
+
+		for (child = items[i]->childs; child != NULL; child = child->next)
+		{
+			if ( k == first )
+			{
+				nodes[i].childs = k;
+			}
+			nodes[k].parent = i;
+			if ( child->prev ) nodes[k].prev = k - 1;
+			if ( child->next ) nodes[k].next = k + 1;
+			k++;
+		}
+		first = k;
+	}
+
+	offset = TREE_SNAPSHOT_ALIGN(sizeof(treeSnapshotHeader_T));
+	image_size = offset + (uint64_t)count * sizeof(treeSnapshotNode_T);
+	image_size = TREE_SNAPSHOT_ALIGN(image_size + strings_size);
+	image_size += (uint64_t)entry_count * sizeof(treeSnapshotEntry_T);
+
+	image = (unsigned char*)calloc(1, (size_t)image_size);
+	if ( image == NULL )
+	{
+		fret = TOOLBOX_ERROR_MALLOC;
+		goto end_of_save;
+	}
+
+	header = (treeSnapshotHeader_T*)image;
+	header->magic = TREE_SNAPSHOT_MAGIC;
+	header->version = TREE_SNAPSHOT_VERSION;
+	header->endianness = TREE_SNAPSHOT_ENDIANNESS;
+	header->header_size = sizeof(treeSnapshotHeader_T);
+	header->node_count = count;
+	header->node_size = sizeof(treeSnapshotNode_T);
+	header->entry_count = entry_count;
+	header->entry_size = sizeof(treeSnapshotEntry_T);
+	header->nodes_offset = offset;
+	header->strings_offset = offset + (uint64_t)count * sizeof(treeSnapshotNode_T);
+	header->strings_size = strings_size;
+	header->entries_offset = TREE_SNAPSHOT_ALIGN(header->strings_offset + strings_size);
+	header->next_unique_id = genericTree->next_unique_id;
+	header->file_size = image_size;
+
+	memcpy(image + header->nodes_offset, nodes, (size_t)count * sizeof(treeSnapshotNode_T));
+	for (i=0; i<count; i++)
+	{
+		memcpy(image + header->strings_offset + nodes[i].name_offset, flexstrget(&items[i]->name), nodes[i].name_length + 1);
+	}
+	genericTree_ReadUnlock(genericTree);
+	locked = 0;
+	if ( entry_count > 0 )
+	{
+		memcpy(image + header->entries_offset, entries, (size_t)entry_count * sizeof(treeSnapshotEntry_T));
+	}
+	header->checksum = treeSnapshot_checksum(image + offset, image_size - offset);
+
+	snprintf(tmpFilename, sizeof(tmpFilename), "%s.tmp", filename);
+	file = fopen(tmpFilename, "wb");
+	if ( file == NULL )
+	{
+		fret = TOOLBOX_ERROR_CANNOT_OPEN_FILE;
+		goto end_of_save;
+	}
+	length = fwrite(image, 1, (size_t)image_size, file);
+	if ( fclose(file) != 0 || length != (size_t)image_size )
+	{
+		unlink(tmpFilename);
+		fret = TOOLBOX_ERROR_WRITING_DISK_FULL;
+		goto end_of_save;
+	}
+	if ( rename(tmpFilename, filename) != 0 )
+	{
+		unlink(tmpFilename);
+		fret = -10;
+		goto end_of_save;
+	}
+
+end_of_save:
+	if ( locked ) genericTree_ReadUnlock(genericTree);
+	if ( items ) free(items);
+	if ( nodes ) free(nodes);
+	if ( entries ) free(entries);
+	if ( image ) free(image);
+
+	return fret;
+#endif
+}
+
+#if !defined(_MSC_VER)
+// section [offset, offset+size) must start at or after start and end inside the file,
+// compared without sums that could wrap. Sets *end.
+static int treeSnapshot_section(uint64_t offset, uint64_t size, uint64_t start, uint64_t file_size, uint64_t * end)
+{
+	if ( offset < start || offset > file_size || size > file_size - offset )
+	{
+		return 0;
+	}
+	*end = offset + size;
+	return 1;
+}
+#endif
+
+// Modified 19.Oct.2026, section bounds are checked without uint64 overflow
+int genericTreeSnapshot_Load(genericTreeSnapshot_T * snapshot, const char * filename)
+{
+#if defined(_MSC_VER)
+	return TOOLBOX_ERROR_NOT_SUPPORTED;
+#else
+	const treeSnapshotHeader_T * header;
+	struct stat statObject;
+	uint64_t end = 0;
+	void * base;
+	int fd;
+
+	if ( snapshot == NULL )
+	{
+		return -1;
+	}
+	if ( filename == NULL )
+	{
+		return -2;
+	}
+
+	memset(snapshot, 0, sizeof(genericTreeSnapshot_T));
+
+	fd = open(filename, O_RDONLY);
+	if ( fd < 0 )
+	{
+		return TOOLBOX_ERROR_CANNOT_OPEN_FILE;
+	}
+	if ( fstat(fd, &statObject) != 0 || statObject.st_size < (off_t)sizeof(treeSnapshotHeader_T) )
+	{
+		close(fd);
+		return TOOLBOX_ERROR_GOT_CORRUPTED;
+	}
+
+	base = mmap(NULL, (size_t)statObject.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd); // mapping stays valid
+	if ( base == MAP_FAILED )
+	{
+		return -10;
+	}
+
+	snapshot->base = (const unsigned char*)base;
+	snapshot->base_size = (uint64_t)statObject.st_size;
+	header = (const treeSnapshotHeader_T*)base;
+
+	if ( header->magic != TREE_SNAPSHOT_MAGIC )
+	{
+		genericTreeSnapshot_Unload(snapshot);
+		return TOOLBOX_ERROR_GOT_CORRUPTED;
+	}
+	if ( header->endianness != TREE_SNAPSHOT_ENDIANNESS )
+	{
+		genericTreeSnapshot_Unload(snapshot);
+		return TOOLBOX_ERROR_ENDIANNESS_NOT_SUPPORTED;
+	}
+	if ( header->version != TREE_SNAPSHOT_VERSION
+	  || header->header_size != sizeof(treeSnapshotHeader_T)
+	  || header->node_size != sizeof(treeSnapshotNode_T)
+	  || header->entry_size != sizeof(treeSnapshotEntry_T) )
+	{
+		genericTreeSnapshot_Unload(snapshot);
+		return TOOLBOX_ERROR_NOT_SUPPORTED;
+	}
+	// sections must lie inside the mapping in order, nodes are only checked when accessed
+	if ( header->file_size != snapshot->base_size
+	  || header->node_count == 0
+	  || header->strings_size == 0
+	  || treeSnapshot_section(header->nodes_offset, (uint64_t)header->node_count * sizeof(treeSnapshotNode_T), sizeof(treeSnapshotHeader_T), snapshot->base_size, &end) <= 0
+	  || treeSnapshot_section(header->strings_offset, header->strings_size, end, snapshot->base_size, &end) <= 0
+	  || treeSnapshot_section(header->entries_offset, (uint64_t)header->entry_count * sizeof(treeSnapshotEntry_T), end, snapshot->base_size, &end) <= 0
+	  || (header->nodes_offset & 7) != 0
+	  || (header->entries_offset & 7) != 0 )
+	{
+		genericTreeSnapshot_Unload(snapshot);
+		return TOOLBOX_ERROR_GOT_CORRUPTED;
+	}
+
+	snapshot->header = header;
+	snapshot->nodes = (const treeSnapshotNode_T*)(snapshot->base + header->nodes_offset);
+	snapshot->strings = (const char*)(snapshot->base + header->strings_offset);
+	snapshot->entries = (const treeSnapshotEntry_T*)(snapshot->base + header->entries_offset);
+
+	return 1;
+#endif
+}
+
+int genericTreeSnapshot_Unload(genericTreeSnapshot_T * snapshot)
+{
+	if ( snapshot == NULL )
+	{
+		return -1;
+	}
+#if !defined(_MSC_VER)
+	if ( snapshot->base )
+	{
+		munmap((void*)snapshot->base, (size_t)snapshot->base_size);
+	}
+#endif
+	memset(snapshot, 0, sizeof(genericTreeSnapshot_T));
+	return 1;
+}
+
+static int treeSnapshot_checkNode(genericTreeSnapshot_T * snapshot, const treeSnapshotNode_T * node)
+{
+	const treeSnapshotHeader_T * header = snapshot->header;
+	uint32_t count = header->node_count;
+
+	if ( (node->parent != TREE_SNAPSHOT_NONE && node->parent >= count)
+	  || (node->childs != TREE_SNAPSHOT_NONE && node->childs >= count)
+	  || (node->next != TREE_SNAPSHOT_NONE && node->next >= count)
+	  || (node->prev != TREE_SNAPSHOT_NONE && node->prev >= count)
+	  || (node->entry != TREE_SNAPSHOT_NONE && node->entry >= header->entry_count) )
+	{
+		return TOOLBOX_ERROR_GOT_CORRUPTED;
+	}
+	if ( (uint64_t)node->name_offset + node->name_length >= header->strings_size
+	  || snapshot->strings[node->name_offset + node->name_length] != '\0' )
+	{
+		return TOOLBOX_ERROR_GOT_CORRUPTED;
+	}
+	return 1;
+}
+
+// Modified 19.Oct.2026, links must agree both ways so every node is reached exactly once
+int genericTreeSnapshot_Validate(genericTreeSnapshot_T * snapshot)
+{
+	const treeSnapshotHeader_T * header;
+	uint32_t i;
+	int iret;
+
+	if ( snapshot == NULL || snapshot->header == NULL )
+	{
+		return TOOLBOX_ERROR_NOT_INITIALIZED;
+	}
+	if ( snapshot->validated )
+	{
+		return 1;
+	}
+
+	header = snapshot->header;
+	if ( treeSnapshot_checksum(snapshot->base + header->nodes_offset, header->file_size - header->nodes_offset) != header->checksum )
+	{
+		return TOOLBOX_ERROR_GOT_CORRUPTED;
+	}
+
+	for (i=0; i<header->node_count; i++)
+	{
+		const treeSnapshotNode_T * node = &snapshot->nodes[i];
+		iret = treeSnapshot_checkNode(snapshot, node);
+		if ( iret <= 0 )
+		{
+			return iret;
+		}
+		// breadth-first order: a child always comes after its parent
+		if ( (i == 0) != (node->parent == TREE_SNAPSHOT_NONE)
+		  || (node->parent != TREE_SNAPSHOT_NONE && node->parent >= i)
+		  || (node->childs != TREE_SNAPSHOT_NONE && node->childs <= i)
+		  || (node->next != TREE_SNAPSHOT_NONE && node->next != i + 1)
+		  || (node->prev != TREE_SNAPSHOT_NONE && node->prev + 1 != i) )
+		{
+			return TOOLBOX_ERROR_GOT_CORRUPTED;
+		}
+		// the top has no siblings, ToTree would link them on genericTree->top
+		if ( i == 0 && (node->next != TREE_SNAPSHOT_NONE || node->prev != TREE_SNAPSHOT_NONE) )
+		{
+			return TOOLBOX_ERROR_GOT_CORRUPTED;
+		}
+		// a checksum is no proof against a crafted file: each link must be matched
+		// by the reverse link, so ToTree can not put one item under two parents
+		if ( node->childs != TREE_SNAPSHOT_NONE
+		  && (snapshot->nodes[node->childs].parent != i || snapshot->nodes[node->childs].prev != TREE_SNAPSHOT_NONE) )
+		{
+			return TOOLBOX_ERROR_GOT_CORRUPTED;
+		}
+		if ( node->next != TREE_SNAPSHOT_NONE
+		  && (snapshot->nodes[node->next].parent != node->parent || snapshot->nodes[node->next].prev != i) )
+		{
+			return TOOLBOX_ERROR_GOT_CORRUPTED;
+		}
+		if ( node->prev != TREE_SNAPSHOT_NONE && snapshot->nodes[node->prev].next != i )
+		{
+			return TOOLBOX_ERROR_GOT_CORRUPTED;
+		}
+		// reached once: by the first child link of its parent, or else by the next link of its previous sibling
+		if ( i > 0 && node->prev == TREE_SNAPSHOT_NONE && snapshot->nodes[node->parent].childs != i )
+		{
+			return TOOLBOX_ERROR_GOT_CORRUPTED;
+		}
+	}
+
+	snapshot->validated = 1;
+	return 1;
+}
+
+int genericTreeSnapshot_GetNode(genericTreeSnapshot_T * snapshot, uint32_t index, const treeSnapshotNode_T ** node)
+{
+	int iret;
+
+	if ( snapshot == NULL || snapshot->header == NULL )
+	{
+		return TOOLBOX_ERROR_NOT_INITIALIZED;
+	}
+	if ( node == NULL )
+	{
+		return -2;
+	}
+	if ( index >= snapshot->header->node_count )
+	{
+		return TOOLBOX_ERROR_OUT_OF_RANGE;
+	}
+
+	if ( snapshot->validated == 0 )
+	{
+		iret = treeSnapshot_checkNode(snapshot, &snapshot->nodes[index]);
+		if ( iret <= 0 )
+		{
+			return iret;
+		}
+	}
+
+	*node = &snapshot->nodes[index];
+	return 1;
+}
+
+// node must come from genericTreeSnapshot_GetNode
+const char * genericTreeSnapshot_GetName(genericTreeSnapshot_T * snapshot, const treeSnapshotNode_T * node)
+{
+	if ( snapshot == NULL || snapshot->strings == NULL || node == NULL )
+	{
+		return NULL;
+	}
+	return snapshot->strings + node->name_offset;
+}
+
+int genericTreeSnapshot_GetEntry(genericTreeSnapshot_T * snapshot, const treeSnapshotNode_T * node, fileEntry_T * loadme)
+{
+	const treeSnapshotEntry_T * entry;
+
+	if ( snapshot == NULL || snapshot->header == NULL )
+	{
+		return TOOLBOX_ERROR_NOT_INITIALIZED;
+	}
+	if ( node == NULL )
+	{
+		return -2;
+	}
+	if ( loadme == NULL )
+	{
+		return -3;
+	}
+	if ( node->entry == TREE_SNAPSHOT_NONE )
+	{
+		return 0;
+	}
+
+	entry = &snapshot->entries[node->entry];
+	loadme->isDirectory = (int)entry->isDirectory;
+	loadme->name = (char*)(snapshot->strings + node->name_offset);
+	loadme->ctime = (time_t)entry->ctime;
+	loadme->mtime = (time_t)entry->mtime;
+	loadme->size = entry->size;
+
+	return 1;
+}
+
+// written 19.Oct.2026
+// Links the items directly since snapshot siblings are already sorted, O(n).
+static int treeSnapshot_toTree(genericTreeSnapshot_T * snapshot, genericTree_T * genericTree);
+
+// Modified 19.Oct.2026, links are made with the write lock held
+int genericTreeSnapshot_ToTree(genericTreeSnapshot_T * snapshot, genericTree_T * genericTree)
+{
+	int iret;
+
+	if ( genericTree == NULL )
+	{
+		return -2;
+	}
+	if ( genericTree->should_always_be_0xAFAF7878 != (int)0xAFAF7878 )
+	{
+		return TOOLBOX_ERROR_NOT_INITIALIZED_OR_GOT_CORRUPTED;
+	}
+	genericTree_WriteLock(genericTree);
+	iret = treeSnapshot_toTree(snapshot, genericTree);
+	genericTree_WriteUnlock(genericTree);
+	return iret;
+}
+
+static int treeSnapshot_toTree(genericTreeSnapshot_T * snapshot, genericTree_T * genericTree)
+{
+	treeItem_T ** items;
+	const treeSnapshotNode_T * node;
+	fileEntry_T * entry;
+	uint32_t count;
+	uint32_t i;
+	int iret;
+
+	if ( snapshot == NULL || snapshot->header == NULL )
+	{
+		return TOOLBOX_ERROR_NOT_INITIALIZED;
+	}
+	if ( genericTree == NULL )
+	{
+		return -2;
+	}
+	if ( genericTree->should_always_be_0xAFAF7878 != (int)0xAFAF7878 )
+	{
+		return TOOLBOX_ERROR_NOT_INITIALIZED_OR_GOT_CORRUPTED;
+	}
+	if ( genericTree->top.childs != NULL )
+	{
+		return TOOLBOX_ERROR_NOT_USING_CORRECTLY;
+	}
+
+	iret = genericTreeSnapshot_Validate(snapshot);
+	if ( iret <= 0 )
+	{
+		return iret;
+	}
+
+	count = snapshot->header->node_count;
+	items = (treeItem_T**)malloc(sizeof(treeItem_T*) * count);
+	if ( items == NULL )
+	{
+		return TOOLBOX_ERROR_MALLOC;
+	}
+
+	items[0] = &genericTree->top;
+	for (i=1; i<count; i++)
+	{
+		items[i] = (treeItem_T*)calloc(1, sizeof(treeItem_T));
+		if ( items[i] == NULL )
+		{
+			while ( --i > 0 ) free(items[i]);
+			free(items);
+			return TOOLBOX_ERROR_MALLOC;
+		}
+	}
+
+	for (i=0; i<count; i++)
+	{
+		treeItem_T * item = items[i];
+		node = &snapshot->nodes[i];
+
+		if ( i > 0 )
+		{
+			flexstrncpy(&item->name, snapshot->strings + node->name_offset, node->name_length);
+			item->parent = items[node->parent];
+			item->tree = genericTree;
+		}
+		item->unique_id = node->unique_id;
+		item->flags = node->flags;
+		if ( node->childs != TREE_SNAPSHOT_NONE ) item->childs = items[node->childs];
+		if ( node->next != TREE_SNAPSHOT_NONE ) item->next = items[node->next];
+		if ( node->prev != TREE_SNAPSHOT_NONE ) item->prev = items[node->prev];
+
+		if ( node->entry != TREE_SNAPSHOT_NONE )
+		{
+			entry = (fileEntry_T*)malloc(sizeof(fileEntry_T));
+			if ( entry )
+			{
+				genericTreeSnapshot_GetEntry(snapshot, node, entry);
+				entry->name = (char*)flexstrget(&item->name);
+				item->client = entry;
+			}
+		}
+	}
+
+	genericTree->itemAmount = (int)count - 1;
+	if ( genericTree->next_unique_id < snapshot->header->next_unique_id )
+	{
+		genericTree->next_unique_id = snapshot->header->next_unique_id;
+	}
+
+	free(items);
+	return 1;
+}
+
+#endif //C_TOOLBOX_GENERIC_TREE_SNAPSHOT
@@ -0,0 +1,132 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-tree-snapshot.h
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Persistent on-disk image of a genericTree_T.
+//      The file is one flat block: header, node array, string table and
+//      fileEntry_T payloads. Nodes are stored in breadth-first order so the
+//      childs of a node are contiguous and already sorted like the tree.
+//      Links are 32-bit indices into the node array, index 0 is the top node.
+//
+//      Loading is a single mmap, only the header is checked up front.
+//      Each node is checked when it is accessed (lazy validation), or the
+//      whole image can be checked once with genericTreeSnapshot_Validate().
+//
+//  Limitations:
+//      Image is written in host endianness, a foreign image is refused.
+//      fileEntry_T::name is not stored, the node name is the file name.
+//      Not available under Windows (no mmap).
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef __C_TOOLBOX_GENERIC_TREE_SNAPSHOT__
+#define __C_TOOLBOX_GENERIC_TREE_SNAPSHOT__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "toolbox-errors.h"
+#include "toolbox-basic-types.h"
+#include "toolbox-filesystem.h"
+#include "toolbox-tree.h"
+
+#define TREE_SNAPSHOT_MAGIC toolbox_FOURCC('G','T','S','N')
+#define TREE_SNAPSHOT_VERSION 1
+#define TREE_SNAPSHOT_ENDIANNESS 0x01020304
+#define TREE_SNAPSHOT_NONE 0xFFFFFFFF // no parent, child, sibling or entry
+
+typedef struct treeSnapshotHeader_S
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t endianness;
+	uint32_t header_size;
+	uint32_t node_count; // includes the top node
+	uint32_t node_size;
+	uint32_t entry_count;
+	uint32_t entry_size;
+	uint64_t nodes_offset;
+	uint64_t strings_offset;
+	uint64_t strings_size;
+	uint64_t entries_offset;
+	uint64_t next_unique_id;
+	uint64_t file_size;
+	uint32_t checksum; // FNV-1a of everything after the header
+	uint32_t reserved;
+} treeSnapshotHeader_T;
+
+typedef struct treeSnapshotNode_S
+{
+	uint32_t parent;
+	uint32_t childs; // first child
+	uint32_t next;
+	uint32_t prev;
+	uint32_t name_offset; // in string table, name is '\0' terminated
+	uint32_t name_length;
+	uint32_t entry; // index in fileEntry payloads or TREE_SNAPSHOT_NONE
+	uint32_t reserved;
+	uint64_t unique_id;
+	uint64_t flags;
+} treeSnapshotNode_T;
+
+typedef struct treeSnapshotEntry_S
+{
+	int64_t ctime;
+	int64_t mtime;
+	uint64_t size;
+	uint32_t isDirectory;
+	uint32_t reserved;
+} treeSnapshotEntry_T;
+
+typedef struct genericTreeSnapshot_S
+{
+	const unsigned char * base; // mmap'ed image
+	uint64_t base_size;
+	const treeSnapshotHeader_T * header;
+	const treeSnapshotNode_T * nodes;
+	const char * strings;
+	const treeSnapshotEntry_T * entries;
+	int validated; // set once genericTreeSnapshot_Validate() passed
+} genericTreeSnapshot_T;
+
+
+// clients_are_file_entries: non-zero if every non-NULL treeItem_T::client is a fileEntry_T
+// (as filled by a traverseDir callback), their payload is then saved too.
+// File is written beside then renamed over filename.
+int genericTree_SaveSnapshot(genericTree_T * genericTree, const char * filename, int clients_are_file_entries);
+
+// maps the file read-only, only the header is verified
+int genericTreeSnapshot_Load(genericTreeSnapshot_T * snapshot, const char * filename);
+int genericTreeSnapshot_Unload(genericTreeSnapshot_T * snapshot);
+
+// full verification of links, names and checksum, only done once
+int genericTreeSnapshot_Validate(genericTreeSnapshot_T * snapshot);
+
+// node 0 is the top. Returns 1 and sets *node, or negative if index or node is invalid.
+int genericTreeSnapshot_GetNode(genericTreeSnapshot_T * snapshot, uint32_t index, const treeSnapshotNode_T ** node);
+const char * genericTreeSnapshot_GetName(genericTreeSnapshot_T * snapshot, const treeSnapshotNode_T * node);
+// returns 0 if node has no payload. loadme->name points inside the mapped string table.
+int genericTreeSnapshot_GetEntry(genericTreeSnapshot_T * snapshot, const treeSnapshotNode_T * node, fileEntry_T * loadme);
+
+// rebuilds a full genericTree_T, genericTree must be constructed and empty.
+// Payloads are malloc'ed as fileEntry_T clients so genericTree_Delete can free them.
+int genericTreeSnapshot_ToTree(genericTreeSnapshot_T * snapshot, genericTree_T * genericTree);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -27,6 +27,77 @@
 
 #	include <string.h>
 #	include <stdlib.h>
+#	include <stddef.h> // offsetof
+
+#	if defined(__GNUC__)
+#		define TREE_PREFETCH(address) __builtin_prefetch(address)
+#	else
+#		define TREE_PREFETCH(address)
+#	endif
+
+#	if C_TOOLBOX_GENERIC_TREE_RWLOCK == 1
+#		if defined(_MSC_VER)
+#			define TREE_LOCK_INIT(tree) InitializeSRWLock(&(tree)->lock)
+#			define TREE_LOCK_DESTROY(tree)
+#			define TREE_READ_LOCK(tree) AcquireSRWLockShared(&(tree)->lock)
+#			define TREE_READ_UNLOCK(tree) ReleaseSRWLockShared(&(tree)->lock)
+#			define TREE_WRITE_LOCK(tree) AcquireSRWLockExclusive(&(tree)->lock)
+#			define TREE_WRITE_UNLOCK(tree) ReleaseSRWLockExclusive(&(tree)->lock)
+#		else
+#			define TREE_LOCK_INIT(tree) tree_lockInit(tree)
+#			define TREE_LOCK_DESTROY(tree) pthread_rwlock_destroy(&(tree)->lock)
+#			define TREE_READ_LOCK(tree) pthread_rwlock_rdlock(&(tree)->lock)
+#			define TREE_READ_UNLOCK(tree) pthread_rwlock_unlock(&(tree)->lock)
+#			define TREE_WRITE_LOCK(tree) pthread_rwlock_wrlock(&(tree)->lock)
+#			define TREE_WRITE_UNLOCK(tree) pthread_rwlock_unlock(&(tree)->lock)
+#		endif
+#	else
+#		define TREE_LOCK_INIT(tree)
+#		define TREE_LOCK_DESTROY(tree)
+#		define TREE_READ_LOCK(tree)
+#		define TREE_READ_UNLOCK(tree)
+#		define TREE_WRITE_LOCK(tree)
+#		define TREE_WRITE_UNLOCK(tree)
+#	endif
+
+#	if C_TOOLBOX_GENERIC_TREE_RWLOCK == 1 && !defined(_MSC_VER)
+static void tree_lockInit(genericTree_T * genericTree)
+{
+	pthread_rwlockattr_t attributes;
+	pthread_rwlockattr_init(&attributes);
+#		if defined(__GLIBC__)
+	// glibc prefers readers by default, a busy query load would hold off the scanner forever
+	pthread_rwlockattr_setkind_np(&attributes, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+#		endif
+	pthread_rwlock_init(&genericTree->lock, &attributes);
+	pthread_rwlockattr_destroy(&attributes);
+}
+#	endif
+
+// items of one genericTree_InsertBulk call, freed with the last of them
+struct treeItemBlock_S
+{
+	size_t remaining;
+	treeItem_T items[1];
+};
+
+static int tree_delete(genericTree_T * genericTree, treeItem_T * remItem);
+
+// written 19.Oct.2026
+static void tree_freeItem(treeItem_T * item)
+{
+	struct treeItemBlock_S * block = item->block;
+
+	flexString_Destructor(&item->name);
+	if ( block == NULL )
+	{
+		free(item);
+	}
+	else if ( --block->remaining == 0 )
+	{
+		free(block);
+	}
+}
 
 
 int genericTree_Constructor(genericTree_T * genericTree)
@@ -46,22 +117,100 @@ int genericTree_Constructor(genericTree_T * genericTree)
    genericTree->itemAmount = 0;
    memset(&genericTree->top, 0, sizeof(genericTree->top));
    genericTree->top.tree = genericTree;
+   TREE_LOCK_INIT(genericTree);
+
+	return 1;
+}
+
+// written 19.Oct.2026
+int genericTree_ReadLock(genericTree_T * genericTree)
+{
+	if ( genericTree == NULL )
+	{
+		return -1;
+	}
+	TREE_READ_LOCK(genericTree);
+	return 1;
+}
+
+// written 19.Oct.2026
+int genericTree_ReadUnlock(genericTree_T * genericTree)
+{
+	if ( genericTree == NULL )
+	{
+		return -1;
+	}
+	TREE_READ_UNLOCK(genericTree);
+	return 1;
+}
+
+// written 19.Oct.2026
+int genericTree_WriteLock(genericTree_T * genericTree)
+{
+	if ( genericTree == NULL )
+	{
+		return -1;
+	}
+	TREE_WRITE_LOCK(genericTree);
+	return 1;
+}
 
+// written 19.Oct.2026
+int genericTree_WriteUnlock(genericTree_T * genericTree)
+{
+	if ( genericTree == NULL )
+	{
+		return -1;
+	}
+	TREE_WRITE_UNLOCK(genericTree);
 	return 1;
 }
 
 // will insert as a child of level, alphabetically sorted between childs
+// Modified 19.Oct.2026, body is tree_insert, called with the write lock held
+static int tree_insert(genericTree_T * genericTree,
+                       treeItem_T * level, // level to insert on
+                       const char * name,
+                       uint64_t unique_id, 
+                       void * client,
+                       treeItem_T ** new_element);
+
 int genericTree_Insert(genericTree_T * genericTree,
                        treeItem_T * level, // level to insert on
                        const char * name,
                        uint64_t unique_id, 
                        void * client,
                        treeItem_T ** new_element)
+{
+	int iret;
+	TOOLBOX_TIMING_SCOPE("genericTree_Insert");
+
+	if ( genericTree == NULL )
+	{
+		return -1;
+	}
+	if ( genericTree->should_always_be_0xAFAF7878 != (int)0xAFAF7878 )
+	{
+		return TOOLBOX_ERROR_NOT_INITIALIZED_OR_GOT_CORRUPTED;
+	}
+	TREE_WRITE_LOCK(genericTree);
+	iret = tree_insert(genericTree, level, name, unique_id, client, new_element);
+	TREE_WRITE_UNLOCK(genericTree);
+	return iret;
+}
+
+static int tree_insert(genericTree_T * genericTree,
+                       treeItem_T * level, // level to insert on
+                       const char * name,
+                       uint64_t unique_id, 
+                       void * client,
+                       treeItem_T ** new_element)
 {
 	treeItem_T * newItem;
 	treeItem_T * loopItem;
 	treeItem_T * prvLoopItem;
 //	treeItem_T * iterator = NULL;
+	flexStringKey_T key;
 
 	unsigned int strLen;
 	int i = 0;
@@ -94,7 +243,12 @@ int genericTree_Insert(genericTree_T * genericTree,
 		free(newItem);
 		return TOOLBOX_ERROR_YOU_PASSED_A_STRING_TOO_BIG;
 	}
-	flexstrcpy(&newItem->name, name);
+	if ( flexstrncpy(&newItem->name, name, strLen) <= 0 )
+	{
+		free(newItem);
+		return TOOLBOX_ERROR_MALLOC;
+	}
+	flexstrkey(&key, name, strLen); // siblings are ordered on its prefix, most without reading their name
 
 	if ( unique_id == 0 )
 	{
@@ -125,7 +279,7 @@ int genericTree_Insert(genericTree_T * genericTree,
 
 	while ( loopItem )
 	{
-		i = flexstrcasecmp(&loopItem->name, name);
+		i = flexstrcasecmpkey(&loopItem->name, &key);
 		if ( i < 0 )
 		{	// candidate > iterator
          
@@ -196,6 +350,7 @@ int genericTree_Insert(genericTree_T * genericTree,
             {  // loopItem->prev == NULL
                if (loopItem->parent == NULL)
                {
+                  flexString_Destructor(&newItem->name);
                   free(newItem);
                   return -21; // corruption error
                }
@@ -227,6 +382,7 @@ int genericTree_Insert(genericTree_T * genericTree,
 				}
 				else
 				{
+					flexString_Destructor(&newItem->name);
 					free(newItem);
 					return TOOLBOX_ERROR_ALREADY_EXISTS;
 				}
@@ -264,6 +420,261 @@ end_of_func_success:
 
 }
 
+// same order as tree_insert: ASCII case-insensitive, then case-sensitive
+static int tree_compareItems(treeItem_T * a, treeItem_T * b)
+{
+	flexStringKey_T key;
+	int i;
+
+	key.str = flexstrget(&b->name);
+	key.length = flexstrlen(&b->name);
+	key.hash = b->name.hash;
+	key.prefix = b->name.prefix;
+	i = flexstrcasecmpkey(&a->name, &key);
+	if ( i == 0 )
+	{
+		i = flexstrcmp(&a->name, key.str);
+	}
+	return i;
+}
+
+// equal names keep their input order, the batch is contiguous in its block
+static int tree_sortCallback(const void * a, const void * b)
+{
+	treeItem_T * itemA = *(treeItem_T * const *)a;
+	treeItem_T * itemB = *(treeItem_T * const *)b;
+	int i = tree_compareItems(itemA, itemB);
+
+	if ( i == 0 )
+	{
+		i = itemA < itemB ? -1 : (itemA > itemB ? 1 : 0);
+	}
+	return i;
+}
+
+// written 19.Oct.2026
+int genericTree_InsertBulk(genericTree_T * genericTree,
+                           treeItem_T * level, // level to insert on, NULL for top
+                           const char * const * names,
+                           const uint64_t * unique_ids, // can be NULL
+                           void * const * clients, // can be NULL
+                           int count,
+                           treeItem_T ** new_elements) // can be NULL
+{
+	struct treeItemBlock_S * block = NULL;
+	treeItem_T ** sorted = NULL;
+	treeItem_T * newItem;
+	treeItem_T * sibling;
+	treeItem_T * anchor;
+	treeItem_T * tail;
+	treeItem_T * previous;
+	uint64_t unique_id;
+	size_t strLen;
+	int is_sorted = 1;
+	int locked = 0;
+	int iret = 1;
+	int i;
+	int j;
+	TOOLBOX_TIMING_SCOPE("genericTree_InsertBulk");
+
+	if ( genericTree == NULL )
+	{
+		return -1;
+	}
+	if ( genericTree->should_always_be_0xAFAF7878 != (int)0xAFAF7878 )
+	{
+		return TOOLBOX_ERROR_NOT_INITIALIZED_OR_GOT_CORRUPTED;
+	}
+	if ( names == NULL )
+	{
+		return -2;
+	}
+	if ( count < 0 )
+	{
+		return -3;
+	}
+	if ( count == 0 )
+	{
+		return 1;
+	}
+	if ( level == NULL )
+	{
+		level = &genericTree->top;
+	}
+	for (i = 0; i < count; i++)
+	{
+		if ( names[i] == NULL )
+		{
+			return -4;
+		}
+		strLen = strlen(names[i]);
+		if ( genericTree->max_name_length > 0 && strLen >= (size_t)genericTree->max_name_length )
+		{
+			return TOOLBOX_ERROR_YOU_PASSED_A_STRING_TOO_BIG;
+		}
+	}
+
+	block = (struct treeItemBlock_S*)calloc(1, offsetof(struct treeItemBlock_S, items) + (size_t)count * sizeof(treeItem_T));
+	sorted = (treeItem_T**)malloc((size_t)count * sizeof(treeItem_T*));
+	if ( block == NULL || sorted == NULL )
+	{
+		if ( block ) free(block);
+		if ( sorted ) free(sorted);
+		return TOOLBOX_ERROR_MALLOC;
+	}
+	block->remaining = (size_t)count;
+	for (i = 0; i < count; i++)
+	{
+		newItem = &block->items[i];
+		if ( flexstrncpy(&newItem->name, names[i], (unsigned int)strlen(names[i])) <= 0 )
+		{
+			iret = TOOLBOX_ERROR_MALLOC;
+			count = i; // names copied so far are freed below
+			goto end_of_func_error;
+		}
+		newItem->client = clients ? clients[i] : NULL;
+		newItem->tree = genericTree;
+		newItem->parent = level;
+		newItem->block = block;
+		sorted[i] = newItem;
+		if ( i > 0 && is_sorted && tree_compareItems(sorted[i-1], newItem) > 0 )
+		{
+			is_sorted = 0;
+		}
+	}
+	if ( is_sorted == 0 )
+	{
+		qsort(sorted, (size_t)count, sizeof(treeItem_T*), tree_sortCallback);
+	}
+
+	// first pass, nothing is linked yet. An item equal to an earlier one (existing
+	// or batch) keeps that first equal in prev: tree_insert links a duplicate right
+	// after the first equal sibling, so x,x,x gives x#1 x#3 x#2.
+	// Any other item keeps in next the existing child it goes before (NULL for the end).
+	TREE_WRITE_LOCK(genericTree);
+	locked = 1;
+	sibling = level->childs;
+	tail = NULL;
+	anchor = NULL;
+	for (i = 0; i < count; i++)
+	{
+		newItem = sorted[i];
+		if ( i > 0 && tree_compareItems(sorted[i-1], newItem) == 0 )
+		{
+			if ( genericTree->accept_duplicate_names == 0 )
+			{
+				iret = TOOLBOX_ERROR_ALREADY_EXISTS;
+				goto end_of_func_error;
+			}
+			newItem->prev = anchor;
+			continue;
+		}
+		j = 1;
+		while ( sibling && (j = tree_compareItems(sibling, newItem)) < 0 )
+		{
+			tail = sibling;
+			sibling = sibling->next;
+		}
+		if ( sibling && j == 0 )
+		{
+			if ( genericTree->accept_duplicate_names == 0 )
+			{
+				iret = TOOLBOX_ERROR_ALREADY_EXISTS;
+				goto end_of_func_error;
+			}
+			anchor = sibling;
+			newItem->prev = anchor;
+		}
+		else
+		{
+			anchor = newItem;
+			newItem->next = sibling;
+		}
+	}
+	// appended items need the last existing child
+	if ( sibling )
+	{
+		tail = sibling;
+	}
+	while ( tail && tail->next )
+	{
+		tail = tail->next;
+	}
+
+	// second pass, link. Unique ids are given in input order, like count calls to tree_insert
+	for (i = 0; i < count; i++)
+	{
+		newItem = &block->items[i];
+		unique_id = unique_ids ? unique_ids[i] : 0;
+		if ( unique_id == 0 )
+		{
+			if ( genericTree->allow_zero_unique_ids == 0 )
+			{
+				unique_id = genericTree->next_unique_id;
+				genericTree->next_unique_id++;
+			}
+		}
+		else if ( genericTree->next_unique_id <= unique_id )
+		{	genericTree->next_unique_id = unique_id + 1;
+		}
+		newItem->unique_id = unique_id;
+		if ( new_elements ) new_elements[i] = newItem;
+	}
+	for (i = 0; i < count; i++)
+	{
+		newItem = sorted[i];
+		if ( newItem->prev )
+		{
+			// right after the first equal, in front of the duplicates linked before it
+			previous = newItem->prev;
+			newItem->next = previous->next;
+		}
+		else if ( newItem->next )
+		{
+			// in front of the existing child, after the batch items already linked there
+			previous = newItem->next->prev;
+		}
+		else
+		{
+			previous = tail;
+		}
+		newItem->prev = previous;
+		if ( newItem->next )
+		{
+			newItem->next->prev = newItem;
+		}
+		else
+		{
+			tail = newItem;
+		}
+		if ( previous )
+		{
+			previous->next = newItem;
+		}
+		else
+		{
+			level->childs = newItem;
+		}
+	}
+	genericTree->itemAmount += count;
+	TREE_WRITE_UNLOCK(genericTree);
+	free(sorted);
+	return 1;
+
+end_of_func_error:
+	if ( locked )
+	{
+		TREE_WRITE_UNLOCK(genericTree);
+	}
+	for (i = 0; i < count; i++)
+	{
+		flexString_Destructor(&block->items[i].name);
+	}
+	free(block);
+	free(sorted);
+	return iret;
+}
+
 // written 29.Jan.2008
 int genericTree_Remove(genericTree_T * genericTree, treeItem_T * remItem)
 {
@@ -279,10 +690,11 @@ int genericTree_Remove(genericTree_T * genericTree, treeItem_T * remItem)
 		return -2;
 	}
 
+   TREE_WRITE_LOCK(genericTree);
    iret = 1;
    while ( remItem->childs != NULL && iret > 0 )
    {
-      iret = genericTree_Delete(genericTree, remItem->childs);
+      iret = tree_delete(genericTree, remItem->childs);
    }
    
    if ( remItem->parent != NULL && remItem->parent->childs == remItem )
@@ -305,14 +717,16 @@ int genericTree_Remove(genericTree_T * genericTree, treeItem_T * remItem)
       genericTree->top.childs = remItem->next;
    }
 
-	free(remItem);
+	tree_freeItem(remItem);
    genericTree->itemAmount--;
+   TREE_WRITE_UNLOCK(genericTree);
 
 	return 1;
 }
 
 
 // deletes and clean clients
+// Modified 19.Oct.2026, childs are freed in one post-order walk instead of recursion
 int genericTree_Delete(genericTree_T * genericTree, treeItem_T * remItem)
 {
    int iret;
@@ -326,12 +740,27 @@ int genericTree_Delete(genericTree_T * genericTree, treeItem_T * remItem)
 	{
 		return -2;
 	}
+
+   TREE_WRITE_LOCK(genericTree);
+   iret = tree_delete(genericTree, remItem);
+   TREE_WRITE_UNLOCK(genericTree);
+   return iret;
+}
+
+static int tree_delete(genericTree_T * genericTree, treeItem_T * remItem)
+{
+   genericTreeCursor_T cursor;
+   treeItem_T * item;
    
-   iret = 1;
-   while ( remItem->childs != NULL && iret > 0 )
+   // every child is freed after its own childs, the walk never looks back at them
+   genericTreeCursor_Constructor(&cursor, genericTree, remItem, TREE_ORDER_POST);
+   while ( (item = genericTreeCursor_Next(&cursor)) != NULL )
    {
-      iret = genericTree_Delete(genericTree, remItem->childs);
+      if (item->client) free(item->client);
+      tree_freeItem(item);
+      genericTree->itemAmount--;
    }
+   remItem->childs = NULL;
    
    if ( remItem->parent != NULL && remItem->parent->childs == remItem )
    {
@@ -355,7 +784,7 @@ int genericTree_Delete(genericTree_T * genericTree, treeItem_T * remItem)
 
    if (remItem->client) free(remItem->client);
    remItem->client = NULL;
-   free(remItem);
+   tree_freeItem(remItem);
    genericTree->itemAmount--;
 
 
@@ -371,19 +800,215 @@ int genericTree_Destructor(genericTree_T * genericTree)
 		return -1;
 	}
 
+   TREE_WRITE_LOCK(genericTree);
    remItem = genericTree->top.childs;
    while (remItem != NULL)
    {
-      genericTree_Delete(genericTree, remItem);
+      tree_delete(genericTree, remItem);
       remItem = genericTree->top.childs;
    }
 
    genericTree->should_always_be_0xAFAF7878 = 0;
+   TREE_WRITE_UNLOCK(genericTree);
+   TREE_LOCK_DESTROY(genericTree);
 
 	return 1;
 }
 
 
 
+// first item at depth target under item (which is at depth), in pre-order, or NULL
+static treeItem_T * tree_firstAtDepth(treeItem_T * item, int depth, int target)
+{
+	treeItem_T * walk = item;
+
+	if ( depth == target )
+	{
+		return item;
+	}
+	for (;;)
+	{
+		if ( depth < target && walk->childs )
+		{
+			walk = walk->childs;
+			depth++;
+		}
+		else
+		{
+			while ( walk != item && walk->next == NULL )
+			{
+				walk = walk->parent;
+				depth--;
+			}
+			if ( walk == item )
+			{
+				return NULL;
+			}
+			walk = walk->next;
+		}
+		if ( depth == target )
+		{
+			return walk;
+		}
+	}
+}
+
+// the item after item (at depth) in the order, or NULL at the end
+static treeItem_T * tree_advance(genericTreeCursor_T * cursor, treeItem_T * item, int * depth)
+{
+	treeItem_T * found;
+	int target;
+	int up;
+
+	switch ( cursor->order )
+	{
+		case TREE_ORDER_PRE:
+			if ( item->childs )
+			{
+				(*depth)++;
+				return item->childs;
+			}
+			while ( item != cursor->level )
+			{
+				if ( item->next )
+				{
+					return item->next;
+				}
+				item = item->parent;
+				(*depth)--;
+			}
+			return NULL;
+
+		case TREE_ORDER_POST:
+			if ( item->next )
+			{
+				item = item->next;
+				while ( item->childs )
+				{
+					item = item->childs;
+					(*depth)++;
+				}
+				return item;
+			}
+			(*depth)--;
+			return item->parent == cursor->level ? NULL : item->parent;
+
+		case TREE_ORDER_BREADTH:
+			// next cousin: climb to an ancestor with a next sibling, go down again to the same depth
+			target = *depth;
+			up = target;
+			while ( item != cursor->level )
+			{
+				while ( item->next )
+				{
+					item = item->next;
+					found = tree_firstAtDepth(item, up, target);
+					if ( found )
+					{
+						return found;
+					}
+				}
+				item = item->parent;
+				up--;
+			}
+			(*depth)++;
+			return tree_firstAtDepth(cursor->level, 0, *depth);
+	}
+	return NULL;
+}
+
+// written 19.Oct.2026
+int genericTreeCursor_Constructor(genericTreeCursor_T * cursor, genericTree_T * genericTree, treeItem_T * level, int order)
+{
+	treeItem_T * first;
+
+	if ( cursor == NULL )
+	{
+		return -1;
+	}
+	if ( level == NULL )
+	{
+		if ( genericTree == NULL )
+		{
+			return -2;
+		}
+		level = &genericTree->top;
+	}
+	if ( order != TREE_ORDER_PRE && order != TREE_ORDER_POST && order != TREE_ORDER_BREADTH )
+	{
+		return -3;
+	}
+
+	cursor->level = level;
+	cursor->order = order;
+	cursor->depth = 0;
+	cursor->upcoming_depth = 1;
+	first = level->childs;
+	if ( first && order == TREE_ORDER_POST )
+	{
+		while ( first->childs )
+		{
+			first = first->childs;
+			cursor->upcoming_depth++;
+		}
+	}
+	cursor->upcoming = first;
+	return 1;
+}
+
+// written 19.Oct.2026
+treeItem_T * genericTreeCursor_Next(genericTreeCursor_T * cursor)
+{
+	treeItem_T * item;
+
+	if ( cursor == NULL || cursor->upcoming == NULL )
+	{
+		return NULL;
+	}
+	item = cursor->upcoming;
+	cursor->depth = cursor->upcoming_depth;
+
+	// find the following one now, a post-order caller may free item
+	cursor->upcoming = tree_advance(cursor, item, &cursor->upcoming_depth);
+	if ( cursor->upcoming )
+	{
+		TREE_PREFETCH(cursor->upcoming->next);
+		TREE_PREFETCH(cursor->upcoming->childs);
+	}
+	return item;
+}
+
+// written 19.Oct.2026
+int genericTree_Visit(genericTree_T * genericTree, treeItem_T * level, int order, genericTreeVisitor_T visitor, void * opaque)
+{
+	genericTreeCursor_T cursor;
+	treeItem_T * item;
+	int iret;
+
+	if ( visitor == NULL )
+	{
+		return -4;
+	}
+	if ( genericTree == NULL )
+	{
+		genericTree = level ? level->tree : NULL;
+	}
+	if ( genericTree )
+	{
+		TREE_READ_LOCK(genericTree);
+	}
+	iret = genericTreeCursor_Constructor(&cursor, genericTree, level, order);
+	while ( iret > 0 && (item = genericTreeCursor_Next(&cursor)) != NULL )
+	{
+		iret = visitor(item, cursor.depth, opaque);
+	}
+	if ( genericTree )
+	{
+		TREE_READ_UNLOCK(genericTree);
+	}
+	return iret;
+}
+
+
 #endif //C_TOOLBOX_BINARY_TREE
 
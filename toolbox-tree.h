@@ -13,8 +13,29 @@
 //      Single-Threaded binairy tree
 //      Elements are stored as a btree_T *
 //
+//      Walks (genericTreeCursor_T or genericTree_Visit) follow the parent
+//      links: no recursion, no allocation, any depth. The node after the
+//      current one is found ahead and its next sibling and first child are
+//      prefetched while the caller works on the current one.
+//
+//      With C_TOOLBOX_GENERIC_TREE_RWLOCK, each genericTree_T has a
+//      reader-writer lock. Insert, Remove, Delete and Destructor take it for
+//      writing for the time of the call, genericTree_Visit and snapshot saving
+//      take it for reading, so query threads run in parallel between updates.
+//      Cursor walks are wrapped by the caller in genericTree_ReadLock/Unlock.
+//      Writers are preferred so a rescan is not starved by queries.
+//
+//      genericTree_InsertBulk loads a whole level at once: the batch is sorted
+//      once (skipped if already sorted), merged with the existing childs in
+//      one pass and its items come from a single allocation, O(n log n)
+//      instead of O(n^2) for n Inserts.
+//
 //  Limitations:
-//      WARNING: Not multi-thread safe, protect by mutex.
+//      WARNING: Not multi-thread safe without C_TOOLBOX_GENERIC_TREE_RWLOCK, protect by mutex.
+//      Locks do not nest: a visitor or a thread holding the read lock must not
+//      call Insert/Remove/Delete or take the read lock again.
+//      Breadth-first walks go down from the level again for every depth,
+//      O(n * depth) instead of O(n). Pre-order and post-order are O(n).
 //
 //  License: Yipp Dual Personal Open Source License and Business Monetary License
 //           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
@@ -31,8 +52,20 @@ extern "C" {
 #include "toolbox-errors.h" 
 #include "toolbox-basic-types.h"  // for uint64_t
 #include "toolbox-flexstring.h"
+#include "toolbox-config.h"
+
+#if C_TOOLBOX_GENERIC_TREE_RWLOCK == 1
+#	if defined(_MSC_VER)
+#		include <windows.h>
+		typedef SRWLOCK genericTreeLock_T;
+#	else
+#		include <pthread.h>
+		typedef pthread_rwlock_t genericTreeLock_T;
+#	endif
+#endif
 
 struct genericTree_S;
+struct treeItemBlock_S;
 
 typedef struct treeItem_S
 {
@@ -45,6 +78,7 @@ typedef struct treeItem_S
 	struct treeItem_S * childs;
 	uint64_t unique_id;
 	uint64_t flags;
+	struct treeItemBlock_S * block; // set if allocated by genericTree_InsertBulk, NULL if malloc'ed alone
 } treeItem_T;
 
 
@@ -60,6 +94,9 @@ typedef struct genericTree_S
 	uint64_t next_unique_id;
 	int characterEncoding; //of type gnucTextEncoding_E
 	int itemAmount;
+#if C_TOOLBOX_GENERIC_TREE_RWLOCK == 1
+	genericTreeLock_T lock;
+#endif
 
 } genericTree_T;
 
@@ -67,6 +104,13 @@ typedef struct genericTree_S
 int genericTree_Constructor(genericTree_T * genericTree);
 int genericTree_Insert(genericTree_T * genericTree, treeItem_T * insert_on_this_level, const char * name, uint64_t unique_id, void * client, treeItem_T ** new_element);
 
+// inserts count childs of level (NULL is the top) like count calls to genericTree_Insert,
+// same order and unique ids, duplicates included (each goes right after the first equal name).
+// unique_ids and clients can be NULL (all 0 / NULL), new_elements (optional) is filled in input order.
+// All or nothing: a too long name, or a duplicate name when accept_duplicate_names is 0
+// (in the batch or with an existing child), inserts none.
+int genericTree_InsertBulk(genericTree_T * genericTree, treeItem_T * level, const char * const * names, const uint64_t * unique_ids, void * const * clients, int count, treeItem_T ** new_elements);
+
 // will delete node and its child, but not free the client void *
 int genericTree_Remove(genericTree_T * genericTree, treeItem_T * removeItem);
 
@@ -75,6 +119,42 @@ int genericTree_Delete(genericTree_T * genericTree, treeItem_T * removeItem);
 
 int genericTree_Destructor(genericTree_T * genericTree);
 
+// no-ops returning 1 without C_TOOLBOX_GENERIC_TREE_RWLOCK
+int genericTree_ReadLock(genericTree_T * genericTree);
+int genericTree_ReadUnlock(genericTree_T * genericTree);
+// for code that links items by hand (snapshot loading), Insert/Remove/Delete take it themselves
+int genericTree_WriteLock(genericTree_T * genericTree);
+int genericTree_WriteUnlock(genericTree_T * genericTree);
+
+
+typedef enum genericTreeOrder_E
+{
+	TREE_ORDER_PRE = 0, // parent before its childs
+	TREE_ORDER_POST, // childs before their parent, the returned item can be removed
+	TREE_ORDER_BREADTH // every item of a depth before the next depth
+} genericTreeOrder_E;
+
+// walks the items under level, level itself is not returned
+typedef struct genericTreeCursor_S
+{
+	treeItem_T * level;
+	treeItem_T * upcoming; // returned by the next call
+	int upcoming_depth;
+	int order;
+	int depth; // of the item last returned, 1 for childs of level
+} genericTreeCursor_T;
+
+// level NULL is the top of genericTree
+int genericTreeCursor_Constructor(genericTreeCursor_T * cursor, genericTree_T * genericTree, treeItem_T * level, int order);
+// NULL once every item was returned.
+// Items must not be inserted or removed during a walk, except that a
+// TREE_ORDER_POST walk may remove (or delete) the item it just returned.
+treeItem_T * genericTreeCursor_Next(genericTreeCursor_T * cursor);
+
+// visitor returns 1 to continue, 0 or negative to stop the walk with that value
+typedef int (*genericTreeVisitor_T)(treeItem_T * item, int depth, void * opaque);
+int genericTree_Visit(genericTree_T * genericTree, treeItem_T * level, int order, genericTreeVisitor_T visitor, void * opaque);
+
 
 
 #ifdef __cplusplus
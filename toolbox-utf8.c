@@ -0,0 +1,611 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-utf8.c
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      UTF-8 <-> wide (wchar_t) transcoding behind the TOOLBOX_utf8* entry points
+//      declared in toolbox.h.
+//      Wide is UTF-16 where wchar_t is 16 bits (Windows) and UTF-32 elsewhere.
+//      Surrogate pairs in wide input are combined in both cases, since the wide
+//      text reader stores UTF-16 files one code unit per wchar_t.
+//
+//      Input length is found once with strlen/memchr, then runs of 16 ASCII
+//      characters are checked and widened or narrowed in one step (SSE2 or NEON
+//      when the compiler targets them, 8 bytes at a time otherwise).
+//      Other characters go through a scalar decoder.
+//
+//      Invalid UTF-8 (bad lead, truncated, overlong, surrogates, above U+10FFFF)
+//      and lone surrogates become U+FFFD, one per maximal invalid subpart like
+//      the Unicode recommendation, so file names always convert.
+//
+//  Limitations:
+//      TOOLBOX_charToWide and TOOLBOX_utf16ToChar use the ANSI code page
+//      under Windows and UTF-8 elsewhere.
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+
+#include "toolbox.h"
+#include "toolbox-errors.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	include <emmintrin.h>
+#	define TOOLBOX_UTF8_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#	include <arm_neon.h>
+#	define TOOLBOX_UTF8_NEON 1
+#endif
+
+#if defined(_MSC_VER)
+#	include <windows.h>
+#	include <intrin.h>
+#endif
+
+#if WCHAR_MAX > 0xFFFF
+#	define TOOLBOX_UTF8_WIDE_IS_UTF32 1
+#endif
+
+#define UTF8_REPLACEMENT 0xFFFD
+
+// bytes of the sequence started by lead, 0 if lead cannot start one
+static const unsigned char g_utf8_sequence_length[256] =
+{
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, // 80..BF continuation
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,2,2,2,2,2,2,2,2,2,2,2,2,2,2, 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, // C0 C1 overlong
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, 4,4,4,4,4,0,0,0,0,0,0,0,0,0,0,0  // F5..FF above U+10FFFF
+};
+
+// true if the 16 bytes at s are all ASCII
+static int utf8_isAscii16(const unsigned char * s)
+{
+#if defined(TOOLBOX_UTF8_SSE2)
+	return _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)s)) == 0;
+#else
+	uint64_t a;
+	uint64_t b;
+	memcpy(&a, s, 8);
+	memcpy(&b, s + 8, 8);
+	return ((a | b) & 0x8080808080808080ULL) == 0;
+#endif
+}
+
+// decodes one sequence of at most n bytes, n >= 1.
+// Returns the bytes consumed, *code is UTF8_REPLACEMENT for an invalid subpart.
+static size_t utf8_decodeOne(const unsigned char * s, size_t n, uint32_t * code)
+{
+	const unsigned int length = g_utf8_sequence_length[s[0]];
+	unsigned char low = 0x80;
+	unsigned char high = 0xBF;
+	uint32_t value;
+	unsigned int i;
+
+	if ( length == 1 )
+	{
+		*code = s[0];
+		return 1;
+	}
+	*code = UTF8_REPLACEMENT;
+	if ( length == 0 || n < 2 )
+	{
+		return 1;
+	}
+
+	// second byte range excludes overlongs, surrogates and values above U+10FFFF
+	if ( s[0] == 0xE0 ) low = 0xA0;
+	else if ( s[0] == 0xED ) high = 0x9F;
+	else if ( s[0] == 0xF0 ) low = 0x90;
+	else if ( s[0] == 0xF4 ) high = 0x8F;
+	if ( s[1] < low || s[1] > high )
+	{
+		return 1;
+	}
+
+	value = s[0] & (0x7F >> length);
+	value = (value << 6) | (s[1] & 0x3F);
+	for (i = 2; i < length; i++)
+	{
+		if ( i >= n || (s[i] & 0xC0) != 0x80 )
+		{
+			return i; // truncated, the valid prefix is one replacement
+		}
+		value = (value << 6) | (s[i] & 0x3F);
+	}
+	*code = value;
+	return length;
+}
+
+// wchar_t needed for the n bytes at s, without terminator
+static size_t utf8_wideLength(const unsigned char * s, size_t n, int * valid)
+{
+	size_t units = 0;
+	size_t i = 0;
+	size_t used;
+	uint32_t code;
+
+	*valid = 1;
+	while ( i < n )
+	{
+		if ( n - i >= 16 && utf8_isAscii16(s + i) )
+		{
+			i += 16;
+			units += 16;
+			continue;
+		}
+		if ( s[i] < 0x80 )
+		{
+			i++;
+			units++;
+			continue;
+		}
+		used = utf8_decodeOne(s + i, n - i, &code);
+		if ( code == UTF8_REPLACEMENT && (used != 3 || s[i] != 0xEF) )
+		{
+			*valid = 0;
+		}
+		i += used;
+#if !defined(TOOLBOX_UTF8_WIDE_IS_UTF32)
+		units += code >= 0x10000 ? 2 : 1;
+#else
+		units++;
+#endif
+	}
+	return units;
+}
+
+// widens 16 ASCII bytes
+static void utf8_widen16(const unsigned char * s, wchar_t * out)
+{
+#if defined(TOOLBOX_UTF8_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i bytes = _mm_loadu_si128((const __m128i*)s);
+	const __m128i low = _mm_unpacklo_epi8(bytes, zero);
+	const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+#	if defined(TOOLBOX_UTF8_WIDE_IS_UTF32)
+	_mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi16(low, zero));
+	_mm_storeu_si128((__m128i*)(out + 4), _mm_unpackhi_epi16(low, zero));
+	_mm_storeu_si128((__m128i*)(out + 8), _mm_unpacklo_epi16(high, zero));
+	_mm_storeu_si128((__m128i*)(out + 12), _mm_unpackhi_epi16(high, zero));
+#	else
+	_mm_storeu_si128((__m128i*)out, low);
+	_mm_storeu_si128((__m128i*)(out + 8), high);
+#	endif
+#elif defined(TOOLBOX_UTF8_NEON)
+	const uint8x16_t bytes = vld1q_u8(s);
+	const uint16x8_t low = vmovl_u8(vget_low_u8(bytes));
+	const uint16x8_t high = vmovl_u8(vget_high_u8(bytes));
+#	if defined(TOOLBOX_UTF8_WIDE_IS_UTF32)
+	vst1q_u32((uint32_t*)out, vmovl_u16(vget_low_u16(low)));
+	vst1q_u32((uint32_t*)(out + 4), vmovl_u16(vget_high_u16(low)));
+	vst1q_u32((uint32_t*)(out + 8), vmovl_u16(vget_low_u16(high)));
+	vst1q_u32((uint32_t*)(out + 12), vmovl_u16(vget_high_u16(high)));
+#	else
+	vst1q_u16((uint16_t*)out, low);
+	vst1q_u16((uint16_t*)(out + 8), high);
+#	endif
+#else
+	int i;
+	for (i = 0; i < 16; i++)
+	{
+		out[i] = (wchar_t)s[i];
+	}
+#endif
+}
+
+// converts n bytes, writes at most capacity wchar_t plus a terminator.
+// Returns 1, or TOOLBOX_ERROR_BUFFER_TOO_SMALL if the output was cut (still terminated).
+static int utf8_toWide(const unsigned char * s, size_t n, wchar_t * out, size_t capacity)
+{
+	size_t i = 0;
+	size_t o = 0;
+	size_t used;
+	uint32_t code;
+
+	while ( i < n )
+	{
+		if ( n - i >= 16 && capacity - o >= 16 && utf8_isAscii16(s + i) )
+		{
+			utf8_widen16(s + i, out + o);
+			i += 16;
+			o += 16;
+			continue;
+		}
+		if ( s[i] < 0x80 )
+		{
+			if ( o == capacity ) break;
+			out[o++] = (wchar_t)s[i++];
+			continue;
+		}
+		used = utf8_decodeOne(s + i, n - i, &code);
+#if !defined(TOOLBOX_UTF8_WIDE_IS_UTF32)
+		if ( code >= 0x10000 )
+		{
+			if ( capacity - o < 2 ) break; // never split a pair
+			code -= 0x10000;
+			out[o++] = (wchar_t)(0xD800 + (code >> 10));
+			out[o++] = (wchar_t)(0xDC00 + (code & 0x3FF));
+			i += used;
+			continue;
+		}
+#endif
+		if ( o == capacity ) break;
+		out[o++] = (wchar_t)code;
+		i += used;
+	}
+	out[o] = L'\0';
+	return i < n ? TOOLBOX_ERROR_BUFFER_TOO_SMALL : 1;
+}
+
+// reads one code point from wide input, combining surrogate pairs.
+// Returns the wchar_t consumed.
+static size_t utf8_wideDecodeOne(const wchar_t * w, size_t n, uint32_t * code)
+{
+	const uint32_t unit = (uint32_t)w[0];
+
+	if ( unit >= 0xD800 && unit <= 0xDBFF )
+	{
+		if ( n >= 2 && (uint32_t)w[1] >= 0xDC00 && (uint32_t)w[1] <= 0xDFFF )
+		{
+			*code = 0x10000 + ((unit - 0xD800) << 10) + ((uint32_t)w[1] - 0xDC00);
+			return 2;
+		}
+		*code = UTF8_REPLACEMENT;
+		return 1;
+	}
+	if ( (unit >= 0xDC00 && unit <= 0xDFFF) || unit > 0x10FFFF )
+	{
+		*code = UTF8_REPLACEMENT;
+		return 1;
+	}
+	*code = unit;
+	return 1;
+}
+
+// narrows 16 wchar_t if they are all ASCII, returns 0 otherwise
+static int utf8_narrow16(const wchar_t * w, unsigned char * out)
+{
+#if defined(TOOLBOX_UTF8_SSE2)
+#	if defined(TOOLBOX_UTF8_WIDE_IS_UTF32)
+	const __m128i a = _mm_loadu_si128((const __m128i*)w);
+	const __m128i b = _mm_loadu_si128((const __m128i*)(w + 4));
+	const __m128i c = _mm_loadu_si128((const __m128i*)(w + 8));
+	const __m128i d = _mm_loadu_si128((const __m128i*)(w + 12));
+	const __m128i any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+	if ( _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(any, _mm_set1_epi32(~0x7F)), _mm_setzero_si128())) != 0xFFFF )
+	{
+		return 0;
+	}
+	_mm_storeu_si128((__m128i*)out, _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+#	else
+	const __m128i a = _mm_loadu_si128((const __m128i*)w);
+	const __m128i b = _mm_loadu_si128((const __m128i*)(w + 8));
+	if ( _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(a, b), _mm_set1_epi16(~0x7F)), _mm_setzero_si128())) != 0xFFFF )
+	{
+		return 0;
+	}
+	_mm_storeu_si128((__m128i*)out, _mm_packus_epi16(a, b));
+#	endif
+	return 1;
+#elif defined(TOOLBOX_UTF8_NEON)
+#	if defined(TOOLBOX_UTF8_WIDE_IS_UTF32)
+	const uint32x4_t a = vld1q_u32((const uint32_t*)w);
+	const uint32x4_t b = vld1q_u32((const uint32_t*)(w + 4));
+	const uint32x4_t c = vld1q_u32((const uint32_t*)(w + 8));
+	const uint32x4_t d = vld1q_u32((const uint32_t*)(w + 12));
+	const uint32x4_t any = vorrq_u32(vorrq_u32(a, b), vorrq_u32(c, d));
+	const uint64x2_t any64 = vreinterpretq_u64_u32(vandq_u32(any, vdupq_n_u32(~0x7FU)));
+	if ( (vgetq_lane_u64(any64, 0) | vgetq_lane_u64(any64, 1)) != 0 )
+	{
+		return 0;
+	}
+	vst1q_u8(out, vcombine_u8(vmovn_u16(vcombine_u16(vmovn_u32(a), vmovn_u32(b))), vmovn_u16(vcombine_u16(vmovn_u32(c), vmovn_u32(d)))));
+#	else
+	const uint16x8_t a = vld1q_u16((const uint16_t*)w);
+	const uint16x8_t b = vld1q_u16((const uint16_t*)(w + 8));
+	const uint64x2_t any64 = vreinterpretq_u64_u16(vandq_u16(vorrq_u16(a, b), vdupq_n_u16(~0x7F)));
+	if ( (vgetq_lane_u64(any64, 0) | vgetq_lane_u64(any64, 1)) != 0 )
+	{
+		return 0;
+	}
+	vst1q_u8(out, vcombine_u8(vmovn_u16(a), vmovn_u16(b)));
+#	endif
+	return 1;
+#else
+	int i;
+	for (i = 0; i < 16; i++)
+	{
+		if ( (uint32_t)w[i] > 0x7F )
+		{
+			return 0;
+		}
+	}
+	for (i = 0; i < 16; i++)
+	{
+		out[i] = (unsigned char)w[i];
+	}
+	return 1;
+#endif
+}
+
+// converts n wchar_t, writes at most capacity bytes plus a terminator
+static int utf8_fromWide(const wchar_t * w, size_t n, unsigned char * out, size_t capacity)
+{
+	size_t i = 0;
+	size_t o = 0;
+	size_t length;
+	uint32_t code;
+
+	while ( i < n )
+	{
+		if ( n - i >= 16 && capacity - o >= 16 && utf8_narrow16(w + i, out + o) )
+		{
+			i += 16;
+			o += 16;
+			continue;
+		}
+		if ( (uint32_t)w[i] < 0x80 )
+		{
+			if ( o == capacity ) break;
+			out[o++] = (unsigned char)w[i++];
+			continue;
+		}
+		length = utf8_wideDecodeOne(w + i, n - i, &code);
+		if ( code < 0x800 )
+		{
+			if ( capacity - o < 2 ) break;
+			out[o++] = (unsigned char)(0xC0 | (code >> 6));
+		}
+		else if ( code < 0x10000 )
+		{
+			if ( capacity - o < 3 ) break;
+			out[o++] = (unsigned char)(0xE0 | (code >> 12));
+			out[o++] = (unsigned char)(0x80 | ((code >> 6) & 0x3F));
+		}
+		else
+		{
+			if ( capacity - o < 4 ) break;
+			out[o++] = (unsigned char)(0xF0 | (code >> 18));
+			out[o++] = (unsigned char)(0x80 | ((code >> 12) & 0x3F));
+			out[o++] = (unsigned char)(0x80 | ((code >> 6) & 0x3F));
+		}
+		out[o++] = (unsigned char)(0x80 | (code & 0x3F));
+		i += length;
+	}
+	out[o] = '\0';
+	return i < n ? TOOLBOX_ERROR_BUFFER_TOO_SMALL : 1;
+}
+
+// utf8 must be terminated inside utf8_buffer_size, or utf8_buffer_size is -1
+static size_t utf8_length(const char * utf8, int utf8_buffer_size)
+{
+	const char * end;
+	if ( utf8_buffer_size < 0 )
+	{
+		return strlen(utf8);
+	}
+	end = (const char*)memchr(utf8, '\0', (size_t)utf8_buffer_size);
+	return end ? (size_t)(end - utf8) : (size_t)utf8_buffer_size;
+}
+
+// written 19.Oct.2026
+// utf16_size is in bytes
+int TOOLBOX_utf8ToWide(const char * utf8, wchar_t * utf16, unsigned int utf16_size)
+{
+	if ( utf8 == NULL )
+	{
+		return -1;
+	}
+	if ( utf16 == NULL )
+	{
+		return -2;
+	}
+	if ( utf16_size < sizeof(wchar_t) )
+	{
+		return TOOLBOX_ERROR_BUFFER_TOO_SMALL;
+	}
+	return utf8_toWide((const unsigned char*)utf8, strlen(utf8), utf16, utf16_size / sizeof(wchar_t) - 1);
+}
+
+// written 19.Oct.2026
+// *utf16 is malloc'ed if NULL or realloc'ed if *utf16_size (bytes) is too small, in one allocation
+int TOOLBOX_utf8ToWideAlloc(const char * utf8, wchar_t ** utf16, unsigned int * utf16_size)
+{
+	size_t length;
+	size_t units;
+	size_t needed;
+	wchar_t * buffer;
+	int valid;
+
+	if ( utf8 == NULL )
+	{
+		return -1;
+	}
+	if ( utf16 == NULL || utf16_size == NULL )
+	{
+		return -2;
+	}
+
+	length = strlen(utf8);
+	units = utf8_wideLength((const unsigned char*)utf8, length, &valid);
+	needed = (units + 1) * sizeof(wchar_t);
+	if ( needed > 0xFFFFFFFFU )
+	{
+		return TOOLBOX_ERROR_OUT_OF_RANGE;
+	}
+	if ( *utf16 == NULL || *utf16_size < needed )
+	{
+		buffer = (wchar_t*)realloc(*utf16, needed);
+		if ( buffer == NULL )
+		{
+			return TOOLBOX_ERROR_MALLOC;
+		}
+		*utf16 = buffer;
+		*utf16_size = (unsigned int)needed;
+	}
+	return utf8_toWide((const unsigned char*)utf8, length, *utf16, units);
+}
+
+// written 19.Oct.2026
+// writeme_size is in bytes
+int TOOLBOX_utf16ToUtf8(const wchar_t * utf16, char * writeme, unsigned int writeme_size)
+{
+	if ( utf16 == NULL )
+	{
+		return -1;
+	}
+	if ( writeme == NULL )
+	{
+		return -2;
+	}
+	if ( writeme_size == 0 )
+	{
+		return TOOLBOX_ERROR_BUFFER_TOO_SMALL;
+	}
+	return utf8_fromWide(utf16, wcslen(utf16), (unsigned char*)writeme, writeme_size - 1);
+}
+
+// written 19.Oct.2026
+int TOOLBOX_charToWide(const char * original, wchar_t * utf16, unsigned int utf16_size)
+{
+#if defined(_MSC_VER)
+	if ( original == NULL )
+	{
+		return -1;
+	}
+	if ( utf16 == NULL )
+	{
+		return -2;
+	}
+	if ( utf16_size < sizeof(wchar_t) )
+	{
+		return TOOLBOX_ERROR_BUFFER_TOO_SMALL;
+	}
+	if ( MultiByteToWideChar(CP_ACP, 0, original, -1, utf16, utf16_size / sizeof(wchar_t)) == 0 )
+	{
+		utf16[utf16_size / sizeof(wchar_t) - 1] = L'\0';
+		return TOOLBOX_ERROR_BUFFER_TOO_SMALL;
+	}
+	return 1;
+#else
+	return TOOLBOX_utf8ToWide(original, utf16, utf16_size);
+#endif
+}
+
+// written 19.Oct.2026
+int TOOLBOX_utf16ToChar(const wchar_t * utf16, char * writeme, unsigned int writeme_size)
+{
+#if defined(_MSC_VER)
+	if ( utf16 == NULL )
+	{
+		return -1;
+	}
+	if ( writeme == NULL )
+	{
+		return -2;
+	}
+	if ( writeme_size == 0 )
+	{
+		return TOOLBOX_ERROR_BUFFER_TOO_SMALL;
+	}
+	if ( WideCharToMultiByte(CP_ACP, 0, utf16, -1, writeme, writeme_size, NULL, NULL) == 0 )
+	{
+		writeme[writeme_size - 1] = '\0';
+		return TOOLBOX_ERROR_BUFFER_TOO_SMALL;
+	}
+	return 1;
+#else
+	return TOOLBOX_utf16ToUtf8(utf16, writeme, writeme_size);
+#endif
+}
+
+// written 19.Oct.2026
+// counts characters: every byte that is not a continuation byte (10xxxxxx)
+int TOOLBOX_utf8strlen(const char * utf8, int utf8_buffer_size)
+{
+	const unsigned char * s = (const unsigned char*)utf8;
+	size_t length;
+	size_t count = 0;
+	size_t i = 0;
+
+	if ( utf8 == NULL )
+	{
+		return -1;
+	}
+	length = utf8_length(utf8, utf8_buffer_size);
+
+#if defined(TOOLBOX_UTF8_SSE2)
+	{
+		const __m128i limit = _mm_set1_epi8((char)0xBF); // as signed, continuation bytes are -128..-65
+		for (; i + 16 <= length; i += 16)
+		{
+			const unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*)(s + i)), limit));
+#	if defined(__GNUC__)
+			count += (size_t)__builtin_popcount(mask);
+#	else
+			count += (size_t)__popcnt(mask);
+#	endif
+		}
+	}
+#elif defined(TOOLBOX_UTF8_NEON)
+	{
+		const int8x16_t limit = vdupq_n_s8((int8_t)0xBF);
+		for (; i + 16 <= length; i += 16)
+		{
+			// 0xFF per counted byte, 8 lanes of 16 bits hold at most 2*255
+			const uint8x16_t counted = vcgtq_s8(vld1q_s8((const int8_t*)(s + i)), limit);
+			const uint64x2_t sums = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(vshrq_n_u8(counted, 7))));
+			count += (size_t)(vgetq_lane_u64(sums, 0) + vgetq_lane_u64(sums, 1));
+		}
+	}
+#endif
+	for (; i < length; i++)
+	{
+		count += (s[i] & 0xC0) != 0x80;
+	}
+	return count > 0x7FFFFFFF ? TOOLBOX_ERROR_OUT_OF_RANGE : (int)count;
+}
+
+// written 19.Oct.2026
+// returns NULL if no terminator in utf8_buffer_size
+char * TOOLBOX_utf8EndOfString(const char * utf8, int utf8_buffer_size)
+{
+	if ( utf8 == NULL )
+	{
+		return NULL;
+	}
+	if ( utf8_buffer_size < 0 )
+	{
+		return (char*)utf8 + strlen(utf8);
+	}
+	return (char*)memchr(utf8, '\0', (size_t)utf8_buffer_size);
+}
+
+// written 19.Oct.2026
+int TOOLBOX_utf8IsValid(const char * utf8, int utf8_buffer_size)
+{
+	int valid;
+
+	if ( utf8 == NULL )
+	{
+		return -1;
+	}
+	utf8_wideLength((const unsigned char*)utf8, utf8_length(utf8, utf8_buffer_size), &valid);
+	return valid;
+}
@@ -0,0 +1,325 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-xml-entity.c
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      XML entity decoder, see toolbox-xml-entity.h
+//      Also implements TOOLBOX_DecodeXmlTextBlobs of toolbox.h
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include <string.h>
+
+#include "toolbox.h"
+#include "toolbox-errors.h"
+#include "toolbox-hex.h"
+#include "toolbox-xml-entity.h"
+
+// characters that can appear between '&' and ';'
+static int xml_isNameChar(unsigned char c)
+{
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '#';
+}
+
+static size_t xml_writeUtf8(unsigned long code, char * out)
+{
+	if ( code < 0x80 )
+	{
+		out[0] = (char)code;
+		return 1;
+	}
+	if ( code < 0x800 )
+	{
+		out[0] = (char)(0xC0 | (code >> 6));
+		out[1] = (char)(0x80 | (code & 0x3F));
+		return 2;
+	}
+	if ( code < 0x10000 )
+	{
+		out[0] = (char)(0xE0 | (code >> 12));
+		out[1] = (char)(0x80 | ((code >> 6) & 0x3F));
+		out[2] = (char)(0x80 | (code & 0x3F));
+		return 3;
+	}
+	out[0] = (char)(0xF0 | (code >> 18));
+	out[1] = (char)(0x80 | ((code >> 12) & 0x3F));
+	out[2] = (char)(0x80 | ((code >> 6) & 0x3F));
+	out[3] = (char)(0x80 | (code & 0x3F));
+	return 4;
+}
+
+// name is what is between '&' and ';'. Returns the bytes written to out, 0 if not an entity.
+// Never more than name_length + 2, the length of the entity itself.
+static size_t xml_resolve(const char * name, size_t name_length, char * out)
+{
+	unsigned long code = 0;
+	unsigned int digit;
+	size_t i = 1;
+	int hexadecimal = 0;
+
+	switch ( name_length )
+	{
+		case 2:
+			if ( name[0] == 'l' && name[1] == 't' ) { out[0] = '<'; return 1; }
+			if ( name[0] == 'g' && name[1] == 't' ) { out[0] = '>'; return 1; }
+			break;
+		case 3:
+			if ( memcmp(name, "amp", 3) == 0 ) { out[0] = '&'; return 1; }
+			break;
+		case 4:
+			if ( memcmp(name, "quot", 4) == 0 ) { out[0] = '"'; return 1; }
+			if ( memcmp(name, "apos", 4) == 0 ) { out[0] = '\''; return 1; }
+			break;
+	}
+	if ( name_length < 2 || name[0] != '#' )
+	{
+		return 0;
+	}
+
+	if ( name[1] == 'x' || name[1] == 'X' )
+	{
+		hexadecimal = 1;
+		i = 2;
+	}
+	if ( i == name_length )
+	{
+		return 0; // "&#;" or "&#x;"
+	}
+	for (; i < name_length; i++)
+	{
+		if ( hexadecimal )
+		{
+			digit = g_toolbox_hex_value[(unsigned char)name[i]];
+			if ( digit > 15 ) return 0;
+		}
+		else
+		{
+			digit = (unsigned int)((unsigned char)name[i] - '0');
+			if ( digit > 9 ) return 0;
+		}
+		if ( code <= 0x10FFFF )
+		{
+			code = code * (hexadecimal ? 16 : 10) + digit; // stays above 0x10FFFF once there
+		}
+	}
+	if ( code == 0 || code > 0x10FFFF || (code >= 0xD800 && code <= 0xDFFF) )
+	{
+		code = 0xFFFD;
+	}
+	return xml_writeUtf8(code, out);
+}
+
+// written 19.Oct.2026
+int xmlEntityDecoder_Constructor(xmlEntityDecoder_T * decoder)
+{
+	if ( decoder == NULL )
+	{
+		return -1;
+	}
+	decoder->pending_length = 0;
+	return 1;
+}
+
+// written 19.Oct.2026
+int xmlEntityDecoder_Feed(xmlEntityDecoder_T * decoder, const char * chunk, size_t length, char * loadme, size_t loadme_size, size_t * written)
+{
+	const char * ampersand;
+	size_t out = 0;
+	size_t i = 0;
+	size_t j;
+	size_t decoded;
+
+	if ( decoder == NULL )
+	{
+		return -1;
+	}
+	if ( chunk == NULL && length > 0 )
+	{
+		return -2;
+	}
+	if ( loadme == NULL && length + decoder->pending_length > 0 )
+	{
+		return -3;
+	}
+	if ( written )
+	{
+		*written = 0;
+	}
+	if ( loadme_size < length + decoder->pending_length )
+	{
+		return TOOLBOX_ERROR_BUFFER_TOO_SMALL;
+	}
+
+	// finish the entity the previous chunk ended in
+	if ( decoder->pending_length > 0 )
+	{
+		while ( i < length && chunk[i] != ';' && xml_isNameChar((unsigned char)chunk[i])
+		        && decoder->pending_length < TOOLBOX_XML_ENTITY_MAX - 1 )
+		{
+			decoder->pending[decoder->pending_length++] = chunk[i++];
+		}
+		if ( i == length )
+		{
+			if ( written ) *written = 0;
+			return 1; // still not complete
+		}
+		decoded = 0;
+		if ( i < length && chunk[i] == ';' )
+		{
+			decoded = xml_resolve(decoder->pending + 1, decoder->pending_length - 1, loadme);
+		}
+		if ( decoded > 0 )
+		{
+			out = decoded;
+			i++; // the ';'
+		}
+		else
+		{
+			memcpy(loadme, decoder->pending, decoder->pending_length);
+			out = decoder->pending_length;
+		}
+		decoder->pending_length = 0;
+	}
+
+	while ( i < length )
+	{
+		ampersand = (const char*)memchr(chunk + i, '&', length - i);
+		if ( ampersand == NULL )
+		{
+			memmove(loadme + out, chunk + i, length - i);
+			out += length - i;
+			break;
+		}
+		j = (size_t)(ampersand - chunk);
+		if ( j > i )
+		{
+			memmove(loadme + out, chunk + i, j - i);
+			out += j - i;
+		}
+		i = j + 1;
+
+		while ( i < length && chunk[i] != ';' && xml_isNameChar((unsigned char)chunk[i]) && i - j < TOOLBOX_XML_ENTITY_MAX - 1 )
+		{
+			i++;
+		}
+		if ( i == length )
+		{
+			// cut by the end of the chunk
+			memcpy(decoder->pending, chunk + j, i - j);
+			decoder->pending_length = (unsigned int)(i - j);
+			break;
+		}
+		decoded = 0;
+		if ( i < length && chunk[i] == ';' )
+		{
+			// out <= j so the entity is read before it is overwritten
+			decoded = xml_resolve(chunk + j + 1, i - j - 1, loadme + out);
+		}
+		if ( decoded > 0 )
+		{
+			out += decoded;
+			i++;
+		}
+		else
+		{
+			loadme[out++] = '&'; // not an entity, what follows is scanned as text
+			i = j + 1;
+		}
+	}
+
+	if ( written )
+	{
+		*written = out;
+	}
+	return 1;
+}
+
+// written 19.Oct.2026
+int xmlEntityDecoder_Finish(xmlEntityDecoder_T * decoder, char * loadme, size_t loadme_size, size_t * written)
+{
+	if ( decoder == NULL )
+	{
+		return -1;
+	}
+	if ( written )
+	{
+		*written = 0;
+	}
+	if ( decoder->pending_length == 0 )
+	{
+		return 1;
+	}
+	if ( loadme == NULL || loadme_size < decoder->pending_length )
+	{
+		return TOOLBOX_ERROR_BUFFER_TOO_SMALL;
+	}
+	memcpy(loadme, decoder->pending, decoder->pending_length);
+	if ( written )
+	{
+		*written = decoder->pending_length;
+	}
+	decoder->pending_length = 0;
+	return 1;
+}
+
+// written 19.Oct.2026
+int C_xmlDecodeEntities(char * text, size_t length, size_t * new_length)
+{
+	xmlEntityDecoder_T decoder;
+	size_t out = 0;
+	size_t tail = 0;
+	int iret;
+
+	if ( text == NULL && length > 0 )
+	{
+		return -1;
+	}
+	xmlEntityDecoder_Constructor(&decoder);
+	iret = xmlEntityDecoder_Feed(&decoder, text, length, text, length, &out);
+	if ( iret <= 0 )
+	{
+		return iret;
+	}
+	// the pending entity is a copy of the end of text, out is before it
+	iret = xmlEntityDecoder_Finish(&decoder, text + out, length - out, &tail);
+	if ( iret <= 0 )
+	{
+		return iret;
+	}
+	if ( new_length )
+	{
+		*new_length = out + tail;
+	}
+	return 1;
+}
+
+// Modified 19.Oct.2026, decoded in place in one pass, temp and temp_size are not needed anymore (can be NULL)
+int TOOLBOX_DecodeXmlTextBlobs(char * source, char ** temp, unsigned int * temp_size)
+{
+	size_t length;
+	int iret;
+
+	(void)temp;
+	(void)temp_size;
+	if ( source == NULL )
+	{
+		return -1;
+	}
+	iret = C_xmlDecodeEntities(source, strlen(source), &length);
+	if ( iret <= 0 )
+	{
+		return iret;
+	}
+	source[length] = '\0';
+	return 1;
+}
@@ -0,0 +1,59 @@
+//  ~~~~~~~~~~~~~~~ C Toolbox ~~~~~~~~~~~~~~~~
+//    portable data manipulation functions
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// toolbox-xml-entity.h
+//
+// Copyright (c) 2026 Francois Oligny-Lemieux
+// All rights reserved
+//
+//      Created: 19.Oct.2026
+//
+//  Description:
+//      Single pass XML entity decoder: &amp; &lt; &gt; &quot; &apos;
+//      and numeric &#1234; &#x4D2; (written as UTF-8).
+//      Text between entities is found with memchr and copied as a block.
+//      Decoded text is never longer than its source, so a whole text can be
+//      decoded in place. An entity cut at the end of a chunk is kept in the
+//      decoder and completed by the next chunk.
+//      Anything that is not a known entity is copied unchanged. Numeric
+//      entities for 0, surrogates or above U+10FFFF become U+FFFD.
+//
+//  License: Yipp Dual Personal Open Source License and Business Monetary License
+//           http://yipp.ca/licenses/dual-personal-open-source-business-monetary-license/
+//
+//  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef __C_TOOLBOX_XML_ENTITY_H__
+#define __C_TOOLBOX_XML_ENTITY_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+// longest "&...;" recognized, longer ones are copied unchanged
+#define TOOLBOX_XML_ENTITY_MAX 32
+
+typedef struct xmlEntityDecoder_S
+{
+	char pending[TOOLBOX_XML_ENTITY_MAX]; // start of an entity cut by the end of a chunk
+	unsigned int pending_length;
+} xmlEntityDecoder_T;
+
+// decode length bytes in place, *new_length gets the decoded length. '\0' is not special.
+int C_xmlDecodeEntities(char * text, size_t length, size_t * new_length);
+
+int xmlEntityDecoder_Constructor(xmlEntityDecoder_T * decoder);
+// loadme_size must be at least length + pending_length.
+// loadme may be chunk only when nothing is pending (pending_length is 0).
+int xmlEntityDecoder_Feed(xmlEntityDecoder_T * decoder, const char * chunk, size_t length, char * loadme, size_t loadme_size, size_t * written);
+// end of input, an unfinished entity is copied unchanged. loadme_size must be at least pending_length.
+int xmlEntityDecoder_Finish(xmlEntityDecoder_T * decoder, char * loadme, size_t loadme_size, size_t * written);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
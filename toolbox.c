@@ -49,6 +49,11 @@
 #	include <windows.h>
 #endif
 
+#if defined(__linux__)
+#	include <fcntl.h>
+#	include <poll.h>
+#endif
+
 #if C_TOOLBOX_LOG_COMMAND == 1
 FILE * g_toolbox_toolbox_log_file = NULL;
 #endif
@@ -133,20 +138,10 @@ int char_extract_filename(const char * source, char * destination, int destinati
 
 
 // utf8 string MUST be terminated.
+// Modified 19.Oct.2026, kept for old callers, see TOOLBOX_utf8EndOfString
 char * C_utf8EndOfString(const char * utf8, int utf8_buffer_size)
 {
-	const char * zero = "\0";
-	if ( utf8 == NULL )
-	{
-		return NULL;
-	}
-
-	if ( utf8_buffer_size == -1 )
-	{
-		utf8_buffer_size = 0x7FFFFFFF;
-	}
-
-	return C_memfind((unsigned char *)utf8, utf8_buffer_size, (unsigned char *)zero, 1); 
+	return TOOLBOX_utf8EndOfString(utf8, utf8_buffer_size);
 }
 
 // written 25.Jan.2008
@@ -627,62 +622,45 @@ int C_GetTempFilename(const char * path, char * out_filename)
 
 
 
+// Modified 19.Oct.2026, formats through C_u32toa, no longer ends the buffer with '\n'
 int C_itoa( unsigned int i, char * toLoad, unsigned int toLoad_size )
 {
-	char temp[22];
-	char *p = &temp[21];
-
-	*p-- = '\0';
-
-	do {
-		*p-- = '0' + i % 10;
-		i /= 10;
-	} while (i > 0);
-
-	strncpy(toLoad, p+1, toLoad_size-1);
-	toLoad[toLoad_size-1] = '\n';
+	int iret;
 
+	if ( toLoad == NULL )
+	{
+		return -2;
+	}
+	iret = C_u32toa(i, toLoad, toLoad_size);
+	if ( iret < 0 )
+	{
+		return iret;
+	}
 	return 1;
 }
 
-// this function has been obtained somewhere on the web.
+// Modified 19.Oct.2026, table driven through C_hexParseU64, no longer limited to 32 digits
 int C_axtoi(const char * hex)
 {
-	int n = 0; // position in string
-	int m = 0; // position in digit[] to shift
-	int count; // loop index
-	int intValue = 0; // integer value of hex string
-	int digit[32]; // hold values to convert
-	if ( strstr(hex, "0x")==hex )
-	{	hex+=2;
-	}
-	while (n < 32)
-	{
-		if (hex[n] == '\0')
-		{	break; }
-		if (hex[n] >= 0x30 && hex[n] <= 0x39 )	//if 0 to 9
-		{	digit[n] = hex[n] & 0x0f; }	//convert to int
-		else if (hex[n] >= 'a' && hex[n] <= 'f') //if a to f
-		{	digit[n] = (hex[n] & 0x0f) + 9; } //convert to int
-		else if (hex[n] >= 'A' && hex[n] <= 'F') //if A to F
-		{	digit[n] = (hex[n] & 0x0f) + 9; } //convert to int
-		else
-		{	break; }
-		n++;
-	}
-	count = n;
-	m = n - 1;
-	n = 0;
-	while (n < count)
-	{
-		// digit[n] is value of hex digit at position n
-		// (m << 2) is the number of positions to shift
-		// OR the bits into return value
-		intValue = intValue | (digit[n] << (m << 2));
-		m--; // adjust the position to set
-		n++; // next digit to process
-	}
-	return (intValue);
+	uint64_t value = 0;
+	int iret;
+
+	if ( hex == NULL )
+	{
+		return 0;
+	}
+	iret = C_hexParseU64(hex, &value, NULL);
+	if ( iret == TOOLBOX_ERROR_OUT_OF_RANGE || value > 0xFFFFFFFFULL )
+	{
+		return (int)0xFFFFFFFF;
+	}
+	return (int)value; // 0 when there is no digit, as before
+}
+
+// written 19.Oct.2026
+int C_hexToString(unsigned char * hex, unsigned int length, char * loadme, unsigned int loadme_length)
+{
+	return C_hexEncode(hex, length, loadme, loadme_length, TOOLBOX_HEX_LOWERCASE);
 }
 
 // will replace in place
@@ -732,14 +710,12 @@ int C_strncpy(char * destination, const char * source, int dst_max_length)
 
 // returns NULL on error or not found
 // returns pointer from inside string when found, at beginning of needle in string.
+// Modified 19.Oct.2026, folds the needle once and uses C_memCaseSearch (ASCII folding)
 char * C_strcasestr(const char * string, const char * needle)
 {
-	int i;
-	int j;
-	int stringLen;
-	int needleLen;
-	int searchLen;
-    
+	caseNeedle_T caseNeedle;
+	const unsigned char * strRet;
+
 	if ( string == NULL )
 	{
 		return NULL;
@@ -749,37 +725,21 @@ char * C_strcasestr(const char * string, const char * needle)
 		return NULL;
 	}
 
-	stringLen = strlen(string);
-	needleLen = strlen(needle);
-	searchLen = stringLen - needleLen + 1;
-
-	for (i=0; i<searchLen; i++)
+	if ( caseNeedle_Constructor(&caseNeedle, needle, strlen(needle)) <= 0 )
 	{
-		for (j=0; ; j++)
-		{
-			if ( j == needleLen )
-			{
-				return (char*) string+i;
-			}
-			if ( tolower(string[i+j]) != tolower(needle[j]) )
-			{
-				// we are not interested in this i
-				break;
-			}
-		}
+		return NULL;
 	}
-	
-	return NULL; // not found
+	strRet = C_memCaseSearch((const unsigned char*)string, strlen(string), &caseNeedle);
+	caseNeedle_Destructor(&caseNeedle);
+
+	return (char*)strRet;
 }
 
 char * C_strncasestr(const char * string, int string_length, const char * needle)
 {
-	int i;
-	int j;
-	int stringLen;
-	int needleLen;
-	int searchLen;
-    
+	caseNeedle_T caseNeedle;
+	const unsigned char * strRet;
+
 	if ( string == NULL )
 	{
 		return NULL;
@@ -788,31 +748,21 @@ char * C_strncasestr(const char * string, int string_length, const char * needle
 	{
 		return NULL;
 	}
+	if ( string_length < 0 )
+	{
+		return NULL;
+	}
 
-	stringLen = string_length;
-	needleLen = strlen(needle);
-	searchLen = stringLen - needleLen + 1;
-
-	for (i=0; i<searchLen; i++)
+	// binary data: the whole string_length is searched, a match can follow an embedded '\0'.
+	// The needle has no '\0' so a match never spans one.
+	if ( caseNeedle_Constructor(&caseNeedle, needle, strlen(needle)) <= 0 )
 	{
-		for (j=0; ; j++)
-		{
-			if ( j == needleLen )
-			{
-				return (char*) string+i;
-			}
-			if ( string[i+j] == '\0' 
-				|| ( tolower(string[i+j]) != tolower(needle[j]) )
-				)
-			{
-				// string is over.
-				// we are not interested in this i
-				break;
-			}
-		}
+		return NULL;
 	}
-	
-	return NULL; // not found
+	strRet = C_memCaseSearch((const unsigned char*)string, (size_t)string_length, &caseNeedle);
+	caseNeedle_Destructor(&caseNeedle);
+
+	return (char*)strRet;
 }
 
 // Author: Francois Oligny-Lemieux
@@ -939,13 +889,9 @@ const char * C_eos(const char * string)
 }
 
 // written 20.Aug.2007
+// Modified 19.Oct.2026, uses C_memSearch, no longer reads past buffer_length
 void * C_memfind(const unsigned char * buffer, int buffer_length, const unsigned char * needle, int needle_length)
 {
-	unsigned int i;
-	unsigned int j; 
-	//unsigned int found;
-	void * out_value = NULL;
-
 	if ( buffer == NULL )
 	{
 		return NULL;
@@ -963,23 +909,7 @@ void * C_memfind(const unsigned char * buffer, int buffer_length, const unsigned
 		return NULL;
 	}
 
-	for (i=0; i<(unsigned int)buffer_length; i++)
-	{
-		for (j=0; j<(unsigned int)needle_length; j++)
-		{
-			if ( buffer[i+j] != needle[j] )
-			{
-				break;
-			}
-		}
-		if ( j == needle_length )
-		{
-			out_value = (void*)&buffer[i];
-			return out_value;
-		}
-	}
-
-	return NULL;
+	return (void*)C_memSearch(buffer, (size_t)buffer_length, needle, (size_t)needle_length);
 }
 
 
@@ -1036,70 +966,48 @@ int putTextBufferReader_into_charArray(textBufferReader * reader, charArray * ar
 }
 
 
-// will append to array.
-int buffer_to_array(const char * buffer, charArray * array_ptr)
-{	
-	int iret;
-	textBufferReader reader;
-	//lineParser parser;
-	//charArray * splitted = NULL;
-
-	if (array_ptr==NULL)
-	{
-		return -1;
-	}
-	if (buffer==NULL)
-	{
-		return -2;
-	}
-
-	//charArray_Destructor(array_ptr);
-	//charArray_Constructor(array_ptr, 1024);
-
-#if TOOLBOX_DEBUG_LEVEL >= 2
-	if ( g_verbose >= 1 )
-	{
-		printf("[buffer_to_array] going to TextBufferReader_Constructor with strlen(buffer)=(%u)\n",strlen(buffer));
-	}
-#endif
+// Modified 19.Oct.2026, lines are split once with a lineIndex_T, no length limit
+static int lineIndex_into_charArray(lineIndex_T * index, charArray * array)
+{
+	char fixed[TEXT_BUFFER_READER_MAX_LINE_SIZE+1];
+	char * line = fixed;
+	size_t line_size = sizeof(fixed);
+	size_t longest = 0;
+	int row;
 
-	iret = TextBufferReader_Constructor(&reader, buffer, strlen(buffer)+1);
-	
-#if TOOLBOX_DEBUG_LEVEL >= 2
-	if ( g_verbose >= 1 )
+	for (row = 0; row < index->count; row++)
 	{
-		printf("[buffer_to_array] TextBufferReader_Constructor returned iret(%d)\n",iret);
+		if ( index->spans[row].length > longest )
+		{
+			longest = index->spans[row].length;
+		}
 	}
-#endif
-
-	if ( iret <= 0 )
+	if ( longest >= line_size )
 	{
-		if ( TOOLBOX_IS_TOOLBOX_SPECIFIC_ERROR(iret) )
-		{	return iret;
-		}
-		else
-		{	return -20;
+		line_size = longest + 1;
+		line = (char*)malloc(line_size);
+		if ( line == NULL )
+		{
+			return TOOLBOX_ERROR_MALLOC;
 		}
 	}
 
-#if TOOLBOX_DEBUG_LEVEL >= 2
-	if ( g_verbose >= 1 )
+	for (row = 0; row < index->count; row++)
 	{
-		printf("[buffer_to_array] going to putTextBufferReader_into_charArray\n");
-	}
+		lineIndex_copyLine(index, row, line, line_size);
+#if TOOLBOX_DEBUG_LEVEL >= 1
+		if ( g_verbose >= 1 )
+		{
+			printf("[buffer_to_array] got line buffer(%s)\n",line);
+		}
 #endif
+		charArray_add(array, line);
+	}
 
-	putTextBufferReader_into_charArray(&reader, array_ptr);
-	
-#if TOOLBOX_DEBUG_LEVEL >= 2
-	if ( g_verbose >= 1 )
+	if ( line != fixed )
 	{
-		printf("[buffer_to_array] putTextBufferReader_into_charArray returned iret(%d)\n",iret);
+		free(line);
 	}
-#endif
-
-	iret = TextBufferReader_Destructor(&reader);
-
 	return 1;
 }
 
@@ -1107,9 +1015,7 @@ int buffer_to_array(const char * buffer, charArray * array_ptr)
 int buffer_to_arrayEx(const char * buffer, charArray * array_ptr, int chop_empty_lines)
 {
 	int iret;
-	textBufferReader reader;
-	//lineParser parser;
-	//charArray * splitted = NULL;
+	lineIndex_T index;
 
 	if (array_ptr==NULL)
 	{
@@ -1120,25 +1026,7 @@ int buffer_to_arrayEx(const char * buffer, charArray * array_ptr, int chop_empty
 		return -2;
 	}
 
-	//charArray_Destructor(array_ptr);
-	//charArray_Constructor(array_ptr, 1024);
-
-#if TOOLBOX_DEBUG_LEVEL >= 2
-	if ( g_verbose >= 1 )
-	{
-		printf("[buffer_to_array] going to TextBufferReader_Constructor with strlen(buffer)=(%u)\n",strlen(buffer));
-	}
-#endif
-
-	iret = TextBufferReader_Constructor(&reader, buffer, strlen(buffer)+1);
-	
-#if TOOLBOX_DEBUG_LEVEL >= 2
-	if ( g_verbose >= 1 )
-	{
-		printf("[buffer_to_array] TextBufferReader_Constructor returned iret(%d)\n",iret);
-	}
-#endif
-
+	iret = lineIndex_Constructor(&index, buffer, -1, chop_empty_lines);
 	if ( iret <= 0 )
 	{
 		if ( TOOLBOX_IS_TOOLBOX_SPECIFIC_ERROR(iret) )
@@ -1149,27 +1037,16 @@ int buffer_to_arrayEx(const char * buffer, charArray * array_ptr, int chop_empty
 		}
 	}
 
-	reader.chop_empty_lines = chop_empty_lines;
+	iret = lineIndex_into_charArray(&index, array_ptr);
+	lineIndex_Destructor(&index);
 
-#if TOOLBOX_DEBUG_LEVEL >= 2
-	if ( g_verbose >= 1 )
-	{
-		printf("[buffer_to_array] going to putTextBufferReader_into_charArray\n");
-	}
-#endif
-
-	putTextBufferReader_into_charArray(&reader, array_ptr);
-	
-#if TOOLBOX_DEBUG_LEVEL >= 2
-	if ( g_verbose >= 1 )
-	{
-		printf("[buffer_to_array] putTextBufferReader_into_charArray returned iret(%d)\n",iret);
-	}
-#endif
-
-	iret = TextBufferReader_Destructor(&reader);
+	return iret;
+}
 
-	return 1;
+// will append to array.
+int buffer_to_array(const char * buffer, charArray * array_ptr)
+{
+	return buffer_to_arrayEx(buffer, array_ptr, 0);
 }
 #endif
 
@@ -1197,6 +1074,7 @@ int C_System2(const char * command, char * loadme, unsigned int loadme_size, int
 	static unsigned int log_fileSize = 0;
 	uint64_t fileSize = 0;
 #endif
+	TOOLBOX_TIMING_SCOPE("C_System2");
 
 	if ( command == NULL )
 	{
@@ -1468,444 +1346,370 @@ int C_GetFileCreationTime(const char * filename, uint64_t * loadme)
 }
 
 
-#if defined(__C_TOOLBOX_TEXT_BUFFER_READER_H__)
-int C_GetNetworkInformation(char * machine_ip,
-							   char * subnet,
-							   char * broadcast,
-							   char * mac,
-							   char * RX_packets,
-							   char * RX_errors,
-							   char * RX_bytes,
-							   char * TX_packets,
-							   char * TX_errors,
-							   char * TX_bytes,
-							   char * collisions,
-							   char * ifconfig, /*INOUT*/
-							   int ifconfig_size,
-							   const char * which_interface)
+// ifconfig/ipconfig output parser, one walk over the selected interface block
+// written 19.Oct.2026
+
+typedef enum ifconfigField_E
 {
-	char temp[256];
-	char command[256];
-	char _line[256];
-	char * line = &_line[0];
-	charArray array;
-	lineParser parser;
-	char * insider = NULL;
-	char * borrowed = NULL;
-	char * position = NULL;
-	int iret;
-	int length;
-	int status;
+	IFCONFIG_NONE = 0,
+	IFCONFIG_IP,
+	IFCONFIG_SUBNET,
+	IFCONFIG_BROADCAST,
+	IFCONFIG_MAC,
+	IFCONFIG_PACKETS, // RX or TX depending on the line
+	IFCONFIG_ERRORS,
+	IFCONFIG_BYTES,
+	IFCONFIG_COLLISIONS,
+	IFCONFIG_RX, // sets the RX/TX context
+	IFCONFIG_TX,
+	IFCONFIG_IGNORE_LINE // inet6, we only report IPv4
+} ifconfigField_E;
+
+typedef struct ifconfigKeyword_S
+{
+	const char * key;
+	unsigned int key_length;
+	ifconfigField_E field;
+} ifconfigKeyword_T;
 
-	temp[255] = '\0';
+// word keys, for "key value" (net-tools 2.x) and "key:value" (net-tools 1.x)
+static const ifconfigKeyword_T g_ifconfig_keywords[] =
+{
+	{ "addr", 4, IFCONFIG_IP }, // "inet addr:1.2.3.4" or Windows
+	{ "broadcast", 9, IFCONFIG_BROADCAST },
+	{ "bytes", 5, IFCONFIG_BYTES },
+	{ "Bcast", 5, IFCONFIG_BROADCAST },
+	{ "collisions", 10, IFCONFIG_COLLISIONS },
+	{ "errors", 6, IFCONFIG_ERRORS },
+	{ "ether", 5, IFCONFIG_MAC },
+	{ "HWaddr", 6, IFCONFIG_MAC },
+	{ "inet", 4, IFCONFIG_IP },
+	{ "inet6", 5, IFCONFIG_IGNORE_LINE },
+	{ "Mask", 4, IFCONFIG_SUBNET },
+	{ "netmask", 7, IFCONFIG_SUBNET },
+	{ "packets", 7, IFCONFIG_PACKETS },
+	{ "RX", 2, IFCONFIG_RX },
+	{ "TX", 2, IFCONFIG_TX },
+	{ NULL, 0, IFCONFIG_NONE }
+};
+
+// ipconfig /all line prefixes, value follows the ':'
+static const ifconfigKeyword_T g_ipconfig_keywords[] =
+{
+	{ "IP Address", 10, IFCONFIG_IP },
+	{ "IPv4 Address", 12, IFCONFIG_IP },
+	{ "Physical Address", 16, IFCONFIG_MAC },
+	{ "Subnet Mask", 11, IFCONFIG_SUBNET },
+	{ NULL, 0, IFCONFIG_NONE }
+};
+
+static ifconfigField_E ifconfig_lookup(const char * word, unsigned int length)
+{
+	const ifconfigKeyword_T * keyword;
 
-#if 0
-	if ( machine_ip == NULL )
-	{
-		return -1;
-	}
-	if ( subnet == NULL )
-	{
-		return -2;
-	}
-	if ( broadcast == NULL )
-	{
-		return -3;
-	}
-	if ( mac == NULL )
-	{
-		return -4;
-	}
-	if ( RX_packets == NULL )
+	// only scan the keys that can match, most words are rejected here
+	switch ( word[0] )
 	{
-		return -5;
+		case 'a': case 'b': case 'B': case 'c': case 'e': case 'H':
+		case 'i': case 'M': case 'n': case 'p': case 'R': case 'T':
+			break;
+		default:
+			return IFCONFIG_NONE;
 	}
-	if ( RX_errors == NULL )
+
+	for (keyword = g_ifconfig_keywords; keyword->key; keyword++)
 	{
-		return -6;
+		if ( keyword->key_length == length
+		  && keyword->key[0] == word[0]
+		  && memcmp(keyword->key, word, length) == 0 )
+		{
+			return keyword->field;
+		}
 	}
-	if ( RX_bytes == NULL )
+	return IFCONFIG_NONE;
+}
+
+// store value in the field unless it was already found
+static void ifconfig_store(networkInformation_T * info, ifconfigField_E field, int context, const char * value, unsigned int length)
+{
+	char * destination = NULL;
+
+	switch ( field )
 	{
-		return -6;
+		case IFCONFIG_IP: destination = info->machine_ip; break;
+		case IFCONFIG_SUBNET: destination = info->subnet; break;
+		case IFCONFIG_BROADCAST: destination = info->broadcast; break;
+		case IFCONFIG_MAC: destination = info->mac; break;
+		case IFCONFIG_PACKETS: destination = (context == IFCONFIG_TX) ? info->TX_packets : info->RX_packets; break;
+		case IFCONFIG_ERRORS: destination = (context == IFCONFIG_TX) ? info->TX_errors : info->RX_errors; break;
+		case IFCONFIG_BYTES: destination = (context == IFCONFIG_TX) ? info->TX_bytes : info->RX_bytes; break;
+		case IFCONFIG_COLLISIONS: destination = info->collisions; break;
+		default: return;
 	}
-	if ( TX_packets == NULL )
+	if ( destination[0] != '\0' || length == 0 )
 	{
-		return -7;
+		return;
 	}
-	if ( TX_errors == NULL )
+	if ( length >= TOOLBOX_NETWORK_INFORMATION_FIELD_SIZE )
 	{
-		return -8;
+		length = TOOLBOX_NETWORK_INFORMATION_FIELD_SIZE-1;
 	}
-	if ( TX_bytes == NULL )
+	memcpy(destination, value, length);
+	destination[length] = '\0';
+}
+
+static void ifconfig_parseLine(networkInformation_T * info, const char * line, const char * end)
+{
+	const ifconfigKeyword_T * keyword;
+	ifconfigField_E pending = IFCONFIG_NONE;
+	int context = IFCONFIG_NONE;
+	const char * word;
+	const char * colon;
+	unsigned int length;
+	ifconfigField_E field;
+
+	while ( line < end && (*line == ' ' || *line == '\t') ) line++;
+
+	// ipconfig "IPv4 Address. . . . . . : 10.0.0.1(Preferred)"
+	if ( line < end && (*line == 'I' || *line == 'P' || *line == 'S') )
 	{
-		return -8;
+		for (keyword = g_ipconfig_keywords; keyword->key; keyword++)
+		{
+			if ( (unsigned int)(end - line) > keyword->key_length
+			  && memcmp(line, keyword->key, keyword->key_length) == 0 )
+			{
+				colon = (const char*)memchr(line, ':', end - line);
+				if ( colon == NULL ) return;
+				word = colon + 1;
+				while ( word < end && *word == ' ' ) word++;
+				length = 0;
+				while ( word + length < end && word[length] != ' ' && word[length] != '(' && word[length] != '\r' ) length++;
+				ifconfig_store(info, keyword->field, IFCONFIG_NONE, word, length);
+				return;
+			}
+		}
 	}
-	if ( collisions == NULL )
+
+	while ( line < end )
 	{
-		return -8;
+		while ( line < end && (*line == ' ' || *line == '\t' || *line == '\r') ) line++;
+		if ( line >= end ) break;
+		word = line;
+		while ( line < end && *line != ' ' && *line != '\t' && *line != '\r' ) line++;
+		length = (unsigned int)(line - word);
+
+		if ( pending != IFCONFIG_NONE )
+		{
+			// "inet addr:1.2.3.4" reaches here with "addr:1.2.3.4"
+			if ( pending == IFCONFIG_IP && length > 5 && memcmp(word, "addr:", 5) == 0 )
+			{
+				word += 5;
+				length -= 5;
+			}
+			ifconfig_store(info, pending, context, word, length);
+			pending = IFCONFIG_NONE;
+			continue;
+		}
+
+		colon = (const char*)memchr(word, ':', length);
+		field = ifconfig_lookup(word, colon ? (unsigned int)(colon - word) : length);
+		if ( field == IFCONFIG_IGNORE_LINE )
+		{
+			return;
+		}
+		if ( field == IFCONFIG_RX || field == IFCONFIG_TX )
+		{
+			context = field;
+		}
+		else if ( field != IFCONFIG_NONE )
+		{
+			if ( colon && colon + 1 < word + length )
+			{
+				ifconfig_store(info, field, context, colon + 1, (unsigned int)(word + length - colon - 1));
+			}
+			else
+			{
+				pending = field; // value is the next word
+			}
+		}
 	}
-#endif
-	
-	if (ifconfig && ifconfig[0] != '\0')
+}
+
+// returns 1 if interface block is found, 0 if not.
+// which_interface can be NULL or empty for the first interface other than loopback.
+int C_ParseNetworkInformation(const char * ifconfig, const char * which_interface, networkInformation_T * info)
+{
+	const char * line;
+	const char * end;
+	const char * next;
+	unsigned int interface_length = 0;
+	int inside = 0;
+	int found = 0;
+
+	if ( ifconfig == NULL )
 	{
-		insider = ifconfig;
-		iret = 1;
+		return -1;
 	}
-	else
+	if ( info == NULL )
 	{
-#if ( defined(_MSC_VER) )
-		strcpy(command,"ipconfig /all");
-		iret = C_System(command, &insider, &status);
-#else
-		strcpy(command,"ifconfig");
-		iret = C_System(command, &insider, &status);
-#endif
+		return -2;
 	}
 
-	if ( iret <= 0 )
+	memset(info, 0, sizeof(networkInformation_T));
+	if ( which_interface && which_interface[0] != '\0' )
 	{
-		return -10;
-		// C_System error
+		interface_length = (unsigned int)strlen(which_interface);
 	}
 
-	if ( insider == NULL )
-	{
-		return -11;
-		// C_System error
-	}
-	
-	if (ifconfig && ifconfig[0] == '\0')
+	end = ifconfig + strlen(ifconfig);
+	for (line = ifconfig; line < end; line = next)
 	{
-		strncpy(ifconfig, insider, ifconfig_size-1);
-		ifconfig[ifconfig_size-1] = '\0';
-	}
+		const char * eol = (const char*)memchr(line, '\n', end - line);
+		if ( eol == NULL ) eol = end;
+		next = eol + 1;
 
-	if ( machine_ip ) machine_ip[0] = '\0';
-	if ( subnet ) subnet[0] = '\0';
-	if ( broadcast ) broadcast[0] = '\0';
-	if ( mac ) mac[0] = '\0';
-	if ( RX_packets ) RX_packets[0] = '\0';
-	if ( RX_errors ) RX_errors[0] = '\0';
-	if ( RX_bytes ) RX_bytes[0] = '\0';
-	if ( TX_packets ) TX_packets[0] = '\0';
-	if ( TX_errors ) TX_errors[0] = '\0';
-	if ( TX_bytes ) TX_bytes[0] = '\0';
-	if ( collisions ) collisions[0] = '\0';
-
-	if ( strlen(insider)==0 )
-	{
-		return -12;
-		// probably the command was good or there is no network adaptor.
-	}
-	
-	if (which_interface != NULL && which_interface[0] != '\0')
-	{
-		printf("will seek to %s\n", which_interface);
-		strcpy(line, "\n");
-		strcat(line, which_interface);
-		position = strstr(insider, line);
-		if (position)
+		if ( line == eol || (line + 1 == eol && *line == '\r') )
 		{
-			insider = position;
+			continue; // blank lines separate blocks in some outputs, not all
 		}
-		else
-		{
-			return 0; // not found
-		}
-	}
 
-	charArray_Constructor(&array,0);
-	lineParser_Constructor(&parser);
-	
-#if ( defined(_MSC_VER) )
-	buffer_to_array(insider, &array);
-	//file_to_array("g:\\tmp\\ifconfig.txt", &array); 
-
-	iret = charArray_getLineThatMatches(&array, "IP Address", &borrowed);
-	if ( iret && borrowed )
-	{
-		strcpy(line,borrowed);
-		position = strstr(line, ": ");
-		length = position - line + 2;
-		if ( position != NULL )
+		// a line not starting with spacing opens a new interface block
+		if ( *line != ' ' && *line != '\t' )
 		{
-			strncpy(temp, line+length, 255);
-			position = strstr(temp, " ");
-			if ( position )
+			if ( inside )
 			{
-				position[0]='\0';
+				break; // our block is done
 			}
-			if ( machine_ip ) strcpy(machine_ip, temp);
-		}
-	}
-
-	iret = charArray_getLineThatMatches(&array, "Physical Address", &borrowed);
-	if ( iret && borrowed )
-	{
-		strcpy(line,borrowed);
-		position = strstr(line, ": ");
-		length = position - line + 2;
-		if ( position != NULL )
-		{
-			strncpy(temp, line+length, 255);
-			position = strstr(temp, " ");
-			if ( position )
+			if ( interface_length )
 			{
-				position[0]='\0';
+				inside = ( (unsigned int)(eol - line) > interface_length
+				        && memcmp(line, which_interface, interface_length) == 0
+				        && (line[interface_length] == ':' || line[interface_length] == ' ' || line[interface_length] == '\t') );
 			}
-			if ( mac ) strcpy(mac, temp);
-		}
-	}
-#else
-	buffer_to_array(insider, &array);
-	
-	iret = charArray_getLineThatMatches(&array, "HWaddr", &borrowed);
-	if ( iret && borrowed )
-	{
-		position = strstr(borrowed, "HWaddr");
-		if ( position != NULL )
-		{
-			strcpy(temp, position+6);
-			iret = lineParser_stripSpacing(&parser, temp, 1,1, &insider);
-			if ( iret > 0 && insider )
+			else
 			{
-				strcpy(temp, insider );
+				inside = !( eol - line > 2 && line[0] == 'l' && line[1] == 'o' && (line[2] == ':' || line[2] == ' ') );
 			}
-			if ( mac ) strcpy(mac, temp);
-		}
-	}
-    
-	iret = charArray_getLineThatMatches(&array, "inet ", &borrowed);
-	if ( iret && borrowed )
-	{
-		strcpy(line,borrowed);
-		position = strstr(line, "inet addr:");
-		if ( position )
-		{
-			length = position - line + 10;
-
-			position = strstr(line, "Bcast");
-			if ( position != NULL )
+			if ( inside == 0 )
 			{
-				position[0]='\0';
-				strcpy(temp, line+length);
-				iret = lineParser_stripSpacing(&parser, temp, 1,1, &insider);
-				if ( iret > 0 && insider )
-				{
-					strcpy(temp, insider );
-				}
-				if ( machine_ip ) strcpy(machine_ip, temp);
+				continue;
 			}
+			found = 1;
+			// net-tools 1.x has "HWaddr" on the name line, parse after the name
+			while ( line < eol && *line != ' ' && *line != '\t' ) line++;
 		}
-	}
-    
-	iret = charArray_getLineThatMatches(&array, "Bcast:", &borrowed);
-	if ( iret && borrowed )
-	{	
-		strcpy(line,borrowed);
-		position = strstr(line, "Bcast:");
-		if ( position )
-		{
-			length = position - line + 6;
 
-			position = strstr(line, "Mask");
-			if ( position != NULL )
-			{
-				position[0]='\0';
-				strcpy(temp, line+length);
-				iret = lineParser_stripSpacing(&parser, temp, 1,1, &insider);
-				if ( iret > 0 && insider )
-				{
-					strcpy(temp, insider );
-				}
-				if ( broadcast ) strcpy(broadcast, temp);
-			}
-		}
-	}
-	
-	iret = charArray_getLineThatMatches(&array, "Mask:", &borrowed);
-	if ( iret && borrowed )
-	{
-		position = strstr(borrowed, "Mask:");
-		if ( position != NULL )
+		if ( inside )
 		{
-			strcpy(temp, position+5);
-			iret = lineParser_stripSpacing(&parser, temp, 1,1, &insider);
-			if ( iret > 0 && insider )
-			{
-				strcpy(temp, insider );
-			}
-			if ( subnet ) strcpy(subnet, temp);
+			ifconfig_parseLine(info, line, eol);
 		}
 	}
 
-	iret = charArray_getLineThatMatches(&array, "RX packets:", &borrowed);
-	if ( iret && borrowed )
-	{
-		strcpy(line,borrowed);
-		position = strstr(line, "RX packets:");
-		if ( position )
-		{
-			length = position - line + 11;
-			position = strstr(line, "errors:");
-			if ( position != NULL )
-			{
-				position[0]='\0';
-				strcpy(temp, line+length);
-				iret = lineParser_stripSpacing(&parser, temp, 1,1, &insider);
-				if ( iret > 0 && insider )
-				{
-					strcpy(temp, insider );
-				}
-				if ( RX_packets ) strcpy(RX_packets, temp);
-			}
-		}
-	}
+	return found;
+}
 
-	iret = charArray_getLineThatMatches(&array, "RX packets:", &borrowed);
-	if ( iret && borrowed )
+// Modified 19.Oct.2026, single pass parser, understands net-tools 1.x and 2.x output
+int C_GetNetworkInformation(char * machine_ip,
+							   char * subnet,
+							   char * broadcast,
+							   char * mac,
+							   char * RX_packets,
+							   char * RX_errors,
+							   char * RX_bytes,
+							   char * TX_packets,
+							   char * TX_errors,
+							   char * TX_bytes,
+							   char * collisions,
+							   char * ifconfig, /*INOUT*/
+							   int ifconfig_size,
+							   const char * which_interface)
+{
+	networkInformation_T info;
+	char * insider = NULL;
+	int iret;
+	int status;
+
+	if (ifconfig && ifconfig[0] != '\0')
 	{
-		strcpy(line,borrowed);
-		position = strstr(line, "errors:");
-		if ( position )
-		{
-			length = position - line + 7;
-			position = strstr(line, "dropped:");
-			if ( position != NULL )
-			{
-				position[0]='\0';
-				strcpy(temp, line+length);
-				iret = lineParser_stripSpacing(&parser, temp, 1,1, &insider);
-				if ( iret > 0 && insider )
-				{
-					strcpy(temp, insider );
-				}
-				if ( RX_errors ) strcpy(RX_errors, temp);
-			}
-		}
+		insider = ifconfig;
+		iret = 1;
 	}
-
-	iret = charArray_getLineThatMatches(&array, "RX bytes:", &borrowed);
-	if ( iret && borrowed )
+	else
 	{
-		strcpy(line,borrowed);
-		position = strstr(line, "RX bytes:");
-		if ( position )
-		{
-			length = position - line + 9;
-			position = strstr(line, "(");
-			if ( position != NULL )
-			{
-				position[0]='\0';
-				strcpy(temp, line+length);
-				iret = lineParser_stripSpacing(&parser, temp, 1,1, &insider);
-				if ( iret > 0 && insider )
-				{
-					strcpy(temp, insider );
-				}
-				if ( RX_bytes ) strcpy(RX_bytes, temp);
-			}
-		}
+#if ( defined(_MSC_VER) )
+		iret = C_System("ipconfig /all", &insider, &status);
+#else
+		iret = C_System("ifconfig", &insider, &status);
+#endif
 	}
 
-	iret = charArray_getLineThatMatches(&array, "TX bytes:", &borrowed);
-	if ( iret && borrowed )
+	if ( iret <= 0 )
 	{
-		strcpy(line,borrowed);
-		position = strstr(line, "TX bytes:");
-		length = position - line + 9;
-
-		position = strstr(position, "(");
-		if ( position != NULL )
-		{
-			position[0]='\0';
-			strcpy(temp, line+length);
-			iret = lineParser_stripSpacing(&parser, temp, 1,1, &insider);
-			if ( iret > 0 && insider )
-			{
-				strcpy(temp, insider );
-			}
-			if ( TX_bytes ) strcpy(TX_bytes, temp);
-		}
+		return -10;
+		// C_System error
 	}
 
-	iret = charArray_getLineThatMatches(&array, "TX packets:", &borrowed);
-	if ( iret && borrowed )
+	if ( insider == NULL )
 	{
-		strcpy(line,borrowed);
-		position = strstr(line, "TX packets:");
-		length = position - line + 11;
-
-		position = strstr(line, "errors:");
-		if ( position != NULL )
-		{
-			position[0]='\0';
-			strcpy(temp, line+length);
-			iret = lineParser_stripSpacing(&parser, temp, 1,1, &insider);
-			if ( iret > 0 && insider )
-			{
-				strcpy(temp, insider );
-			}
-			if ( TX_packets ) strcpy(TX_packets, temp);
-		}
+		return -11;
+		// C_System error
 	}
-    	
-	iret = charArray_getLineThatMatches(&array, "TX packets:", &borrowed);
-	if ( iret && borrowed )
+	
+	if (ifconfig && ifconfig[0] == '\0')
 	{
-		strcpy(line,borrowed);
-		position = strstr(line, "errors:");
-		length = position - line + 7;
+		strncpy(ifconfig, insider, ifconfig_size-1);
+		ifconfig[ifconfig_size-1] = '\0';
+	}
 
-		position = strstr(line, "dropped:");
-		if ( position != NULL )
-		{
-			position[0]='\0';
-			strcpy(temp, line+length);
-			iret = lineParser_stripSpacing(&parser, temp, 1,1, &insider);
-			if ( iret > 0 && insider )
-			{
-				strcpy(temp, insider );
-			}
-			if ( TX_errors ) strcpy(TX_errors, temp);
-		}
+	if ( machine_ip ) machine_ip[0] = '\0';
+	if ( subnet ) subnet[0] = '\0';
+	if ( broadcast ) broadcast[0] = '\0';
+	if ( mac ) mac[0] = '\0';
+	if ( RX_packets ) RX_packets[0] = '\0';
+	if ( RX_errors ) RX_errors[0] = '\0';
+	if ( RX_bytes ) RX_bytes[0] = '\0';
+	if ( TX_packets ) TX_packets[0] = '\0';
+	if ( TX_errors ) TX_errors[0] = '\0';
+	if ( TX_bytes ) TX_bytes[0] = '\0';
+	if ( collisions ) collisions[0] = '\0';
+
+	if ( insider[0] == '\0' )
+	{
+		return -12;
+		// probably the command was good or there is no network adaptor.
 	}
 	
-	iret = charArray_getLineThatMatches(&array, "collisions:", &borrowed);
-	if ( iret && borrowed )
+	if (which_interface != NULL && which_interface[0] != '\0')
 	{
-		strcpy(line,borrowed);
-		position = strstr(line, "collisions:");
-		length = position - line + 11;
+		TOOLBOX_LOG(TOOLBOX_LOG_DEBUG, "will seek to %s\n", which_interface);
+	}
 
-		position = strstr(line, "txqueuelen:");
-		if ( position != NULL )
-		{
-			position[0]='\0';
-			strcpy(temp, line+length);
-			iret = lineParser_stripSpacing(&parser, temp, 1,1, &insider);
-			if ( iret > 0 && insider )
-			{
-				strcpy(temp, insider );
-			}
-			if ( collisions ) strcpy(collisions, temp);
-		}
+	iret = C_ParseNetworkInformation(insider, which_interface, &info);
+	if ( iret <= 0 )
+	{
+		return 0; // not found
 	}
-#endif
-    
-	charArray_Destructor(&array);
-	lineParser_Destructor(&parser);
+
+	if ( machine_ip ) strcpy(machine_ip, info.machine_ip);
+	if ( subnet ) strcpy(subnet, info.subnet);
+	if ( broadcast ) strcpy(broadcast, info.broadcast);
+	if ( mac ) strcpy(mac, info.mac);
+	if ( RX_packets ) strcpy(RX_packets, info.RX_packets);
+	if ( RX_errors ) strcpy(RX_errors, info.RX_errors);
+	if ( RX_bytes ) strcpy(RX_bytes, info.RX_bytes);
+	if ( TX_packets ) strcpy(TX_packets, info.TX_packets);
+	if ( TX_errors ) strcpy(TX_errors, info.TX_errors);
+	if ( TX_bytes ) strcpy(TX_bytes, info.TX_bytes);
+	if ( collisions ) strcpy(collisions, info.collisions);
 
 	return 1;
 }
-#endif
 
-#if defined(__TOOLBOX_NETWORK_H__)
+#if !defined(_MSC_VER) || defined(__TOOLBOX_NETWORK_H__)
+// Modified 19.Oct.2026, gethostname() instead of running `hostname`
 int C_GetHostname(char * hostname, int hostname_bufsize)
 {
 	int iret;
-	int status;
-	char * insider = NULL;
 
 	if ( hostname == NULL )
 	{
@@ -1936,42 +1740,147 @@ int C_GetHostname(char * hostname, int hostname_bufsize)
 	}
 	return -10; // failed ?? :(
 #else
-	iret = C_System("hostname", &insider);
-	if ( iret > 0 && insider )
+	iret = gethostname(hostname, hostname_bufsize);
+	hostname[hostname_bufsize-1] = '\0'; // not terminated when truncated
+	if ( iret != 0 )
 	{
-		char * strRet;
-		strncpy(hostname, insider, hostname_bufsize-1);
-		hostname[hostname_bufsize-1] = '\0';
-		strRet = strchr(hostname, '\r');
-		if ( strRet )
+		hostname[0] = '\0';
+		return -10;
+	}
+	return 1;
+#endif
+}
+
+// written 19.Oct.2026
+int hostnameCache_Constructor(hostnameCache_T * cache)
+{
+	if ( cache == NULL )
+	{
+		return -1;
+	}
+
+	cache->hostname[0] = '\0';
+	cache->valid = 0;
+	cache->fd = -1;
+#if defined(__linux__)
+	// the kernel flags this file with POLLERR|POLLPRI when the hostname changes
+	cache->fd = open("/proc/sys/kernel/hostname", O_RDONLY | O_CLOEXEC);
+#endif
+	return 1;
+}
+
+int hostnameCache_Destructor(hostnameCache_T * cache)
+{
+	if ( cache == NULL )
+	{
+		return -1;
+	}
+#if defined(__linux__)
+	if ( cache->fd >= 0 )
+	{
+		close(cache->fd);
+	}
+#endif
+	cache->fd = -1;
+	cache->valid = 0;
+	return 1;
+}
+
+// written 19.Oct.2026
+int hostnameCache_Get(hostnameCache_T * cache, char * hostname, int hostname_bufsize)
+{
+	int iret;
+
+	if ( cache == NULL )
+	{
+		return -1;
+	}
+	if ( hostname == NULL )
+	{
+		return -2;
+	}
+	if ( hostname_bufsize <= 0 )
+	{
+		return -3;
+	}
+
+#if defined(__linux__)
+	if ( cache->valid && cache->fd >= 0 )
+	{
+		struct pollfd watch;
+		watch.fd = cache->fd;
+		watch.events = POLLERR | POLLPRI;
+		watch.revents = 0;
+		if ( poll(&watch, 1, 0) != 0 )
 		{
-			*strRet = '\0';
+			cache->valid = 0; // changed, or poll failed
 		}
-		strRet = strchr(hostname, '\n');
-		if ( strRet )
+	}
+
+	if ( cache->valid == 0 && cache->fd >= 0 )
+	{
+		ssize_t length = pread(cache->fd, cache->hostname, sizeof(cache->hostname)-1, 0);
+		if ( length > 0 )
 		{
-			*strRet = '\0';
+			if ( cache->hostname[length-1] == '\n' )
+			{
+				length--;
+			}
+			cache->hostname[length] = '\0';
+			cache->valid = 1;
 		}
 	}
+#else
+	cache->valid = 0; // no change notification, always ask
 #endif
+
+	if ( cache->valid == 0 )
+	{
+		iret = C_GetHostname(cache->hostname, sizeof(cache->hostname));
+		if ( iret <= 0 )
+		{
+			hostname[0] = '\0';
+			return iret;
+		}
+		// not cached, a change could not be noticed without the proc file
+	}
+
+	strncpy(hostname, cache->hostname, hostname_bufsize-1);
+	hostname[hostname_bufsize-1] = '\0';
 	return 1;
 }
 #endif
 
-#if defined(__C_TOOLBOX_TEXT_BUFFER_READER_H__)
+#if !defined(_MSC_VER)
+// Modified 19.Oct.2026, reads the kernel route table instead of parsing `route -n`
+int C_GetDefaultGateway(char * gateway, int gateway_bufsize)
+{
+	int iret;
+
+	iret = C_GetDefaultGatewayEx(gateway, gateway_bufsize, TOOLBOX_ROUTE_IPV4);
+	if ( iret == -11 )
+	{
+		printf("ERROR - Found gateway is bigger than supplied buffer size(%d)\n", gateway_bufsize);
+		return -20;
+	}
+	return iret;
+}
+#else
 // written 17.May.2007
+// Modified 19.Oct.2026, one lineIndex_T scan of `route PRINT` instead of charArray line removal
 int C_GetDefaultGateway(char * gateway, int gateway_bufsize)
 {
 	int iret;
 	int status;
 	int fret = -20; // general not succeeded
-	char * line;
 	char * insider = NULL;
-	char * strRet;
-	int row;
-	int count = 0;
-	charArray array;
-	lineParser parser;
+	const char * line;
+	const char * word[3];
+	size_t word_length[3];
+	size_t length;
+	int row = -1;
+	int count;
+	lineIndex_T index;
 
 	if ( gateway == NULL )
 	{
@@ -1984,81 +1893,47 @@ int C_GetDefaultGateway(char * gateway, int gateway_bufsize)
 	}
 
 	gateway[0] = '\0';
-	charArray_Constructor(&array, 20);
-	lineParser_Constructor(&parser);
 
-#if defined(_MSC_VER)
 	iret = C_System("route PRINT", &insider, &status);
-#else
-	iret = C_System("route -n", &insider, &status);
-#endif
-
-	if ( iret > 0 && insider )
+	if ( iret <= 0 || insider == NULL )
 	{
-		buffer_to_array(insider, &array);
-		row = -1;
-		iret = charArray_getLineThatMatchesEx(&array, "0.0.0.0", 0, -1, &row, &insider);
-		while ( iret > 0 && insider && count < 100 )
-		{
-			line = insider;
-			insider = NULL;
-			iret = lineParser_stripSpacing(&parser, line, 1, 0, &insider);
-			if ( iret <= 0 || insider == NULL )
-			{
-				insider = line;
-			}
-			if ( strstr(insider, "0.0.0.0")==insider ) // matches begining
-			{
-				// there must be two 0.0.0.0 on the line to be the wanted line
-				strRet = strstr(insider+7, "0.0.0.0");
-				if ( strRet )
-				{
-					// it's my line
-					insider = NULL;
-					iret = lineParser_replaceAll(&parser, line, "0.0.0.0", "", &insider);
-					if ( insider )
-					{
-						iret = lineParser_stripSpacing(&parser, insider, 1, 0, &insider);
-						if ( iret > 0 && insider )
-						{
-							strRet = strchr(insider, ' ');
-							if ( strRet )
-							{
-								*strRet = '\0';
-								if ( strlen(insider) >= (unsigned int)gateway_bufsize )
-								{
-									printf("ERROR - Found gateway is bigger than supplied buffer size(%d)\n", gateway_bufsize);
-								}
-								else
-								{
-									strcpy(gateway, insider);
-									fret = 1;
-									break;
-								}
-							}
-						}
-					}
-					
-				}
-				else
-				{
-					// not default gateway line
-				}
-			}
-			charArray_removeLineWithIndexAndAllBefore(&array, row);
-			count++;
-			row = -1;
-			iret = charArray_getLineThatMatchesEx(&array, "0.0.0.0", 0, -1, &row, &insider);
-		}
+		return -10; // executing command failed.
+	}
 
+	iret = lineIndex_Constructor(&index, insider, -1, 1);
+	if ( iret <= 0 )
+	{
+		return iret;
 	}
-	else
+
+	// the wanted line is "0.0.0.0 0.0.0.0 <gateway> <interface> <metric>"
+	while ( lineIndex_getLineThatStartsWith(&index, "0.0.0.0", row+1, &row) > 0 )
 	{
-		fret = -10; // executing command failed.
+		lineIndex_getLine(&index, row, &line, &length);
+		for (count = 0; count < 3; count++)
+		{
+			while ( length > 0 && (*line == ' ' || *line == '\t') ) { line++; length--; }
+			word[count] = line;
+			while ( length > 0 && *line != ' ' && *line != '\t' ) { line++; length--; }
+			word_length[count] = line - word[count];
+		}
+		if ( word_length[1] != 7 || memcmp(word[1], "0.0.0.0", 7) != 0
+		  || word_length[2] == 0 || word[2][0] < '0' || word[2][0] > '9' ) // skips On-link
+		{
+			continue; // not default gateway line
+		}
+		if ( word_length[2] >= (unsigned int)gateway_bufsize )
+		{
+			printf("ERROR - Found gateway is bigger than supplied buffer size(%d)\n", gateway_bufsize);
+			break;
+		}
+		memcpy(gateway, word[2], word_length[2]);
+		gateway[word_length[2]] = '\0';
+		fret = 1;
+		break;
 	}
-	
-	lineParser_Destructor(&parser);
-	charArray_Destructor(&array);
+
+	lineIndex_Destructor(&index);
 	return fret;
 }
 #endif
@@ -2075,19 +1950,10 @@ int C_Sleep(int milliseconds)
 
 static const char * const g_rand_source_alpha = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
 static const char * const g_rand_source_num = "0123456789";
-static int g_srand_done = 0;
 // will write length char in toload + '\0', thus toload must be at least length+1 big
+// Modified 19.Oct.2026, uniform letters from the per-thread generator of toolbox-random
 int C_Random_alpha(int length, char * toload, int buffer_size)
 {
-	int random_value = 0;
-	unsigned int srandom_value = 0;
-	char temp[256]="";
-	int count=0;
-	//int iret;
-	int i;
-	int number;
-	char letter[3]="";
-
 	if ( toload == NULL )
 	{
 		return -1;
@@ -2098,78 +1964,20 @@ int C_Random_alpha(int length, char * toload, int buffer_size)
 		return -2;
 	}
 
-	if ( length >= buffer_size || length >= 127 )
+	if ( length >= buffer_size )
 	{
 		return -3;
 	}
 
-	temp[254]='\0';
-	temp[255]='\0';
-    
-	if ( g_srand_done == 0 )
-	{
-		srandom_value = (unsigned int) time(NULL);
-        srand(srandom_value);
-		g_srand_done = 1;
-	}
-	random_value = rand();
-
-	//printf("<!-- rand(%d) -->\n",random_value);
-
-	snprintf(temp, 255, "%d",random_value);
-
-	while ( count < 200 )
-	{
-		random_value = rand();
-		snprintf(temp+strlen(temp),255-strlen(temp),"%d",random_value);
-		if ( temp[254] != '\0' )
-		{
-			// done
-			break;
-		}
-		count++;
-	}
-
-	for (i=0; i<length; i++)
-	{
-		//number = atoi(&temp[i]);
-		letter[0] = temp[i];
-		letter[1] = temp[i+1];
-		letter[2] = '\0';
-		number = atoi(letter);
-		if ( strlen(g_rand_source_alpha) > (unsigned int) number )
-		{
-			toload[i] = g_rand_source_alpha[number];
-		}
-		else
-		{
-			letter[1] = '\0';
-			number = atoi(letter);
-			toload[i] = g_rand_source_alpha[number];
-		}
-	}
-	if ( length < buffer_size )
-	{
-		toload[length]='\0';
-	}
-	else
-	{
-		toload[buffer_size-1]='\0';
-	}
+	C_RandomFromAlphabet(toload, (size_t)length, g_rand_source_alpha, 26);
+	toload[length]='\0';
 
 	return 1;
 }
 
+// Modified 19.Oct.2026, was limited to the digits of a few rand() and could write past buffer_size
 int C_Random_numeric(int length, char * toload, int buffer_size)
 {
-	int random_value = 0;
-	unsigned int srandom_value = 0;
-	char temp[256]="";
-	int count=0;
-	int i;
-	int number;
-	char letter[2]="";
-
 	if ( toload == NULL )
 	{
 		return -1;
@@ -2180,91 +1988,31 @@ int C_Random_numeric(int length, char * toload, int buffer_size)
 		return -2;
 	}
     
-	if ( length > 255 )
+	if ( length >= buffer_size )
 	{
 		return -3;
 	}
-    
-	memset(&temp[0], 0, 256); // important for snprintf below since I don't add '\0' everytime
-	
-	if ( g_srand_done == 0 )
-	{
-		srandom_value = (unsigned int) time(NULL);
-        srand(srandom_value);
-		g_srand_done = 1;
-	}
-	random_value = rand();
-
-	snprintf(temp,255,"%d",random_value);
-
-	while ( count < 20 )
-	{	
-		if ( strlen(temp) >= (unsigned int) length )
-		{
-			break;
-		}
-		random_value = rand();
-		snprintf(temp+strlen(temp),255-strlen(temp),"%d",random_value);
-		count++;
-	}
-	
-	if ( strlen(temp) < (unsigned int) length )
-	{
-		length = strlen(temp);
-	}
 
-	for (i=0; i<length; i++)
-	{
-		letter[0] = temp[i];
-		letter[1] = '\0';
-		number = atoi(letter);
-		if ( number>0 && (unsigned int) number < strlen(g_rand_source_num)  )
-		{
-			toload[i] = g_rand_source_num[number];
-		}
-		else
-		{
-			toload[i] = '0';
-		}
-	}
-	if ( length < buffer_size )
-	{
-		toload[length]='\0';
-	}
-	else
-	{
-		toload[buffer_size-1]='\0';
-	}
+	C_RandomFromAlphabet(toload, (size_t)length, g_rand_source_num, 10);
+	toload[length]='\0';
 
 	return 1;
 }
 
+// Modified 19.Oct.2026, strlen was evaluated for every byte
 int C_Tolower(char * source)
 {
-	unsigned int i=0;
 	if ( source == NULL )
 	{
 		return -1;
 	}
 
-	for (i=0; i<strlen(source); i++)
-	{
-		if ( source[i]=='\0' )
-		{
-			break;
-		}
-
-		source[i]=tolower(source[i]);
-	}
-
-	return 1;
+	return C_asciiToLower(source, strlen(source));
 }
 
 int C_memFind(unsigned char * input, unsigned int inputLength, unsigned char * needle, unsigned int needleLength, unsigned char ** out_position_in_input)
 {
-	unsigned int inputLengthRemaining = inputLength;
-	unsigned int inputOffset = 0;
-	int iret;
+	const unsigned char * position;
 
 	if ( input == NULL )
 	{
@@ -2287,23 +2035,18 @@ int C_memFind(unsigned char * input, unsigned int inputLength, unsigned char * n
 		return 0;
 	}
 
-	while (inputLengthRemaining >= needleLength)
+	position = C_memSearch(input, inputLength, needle, needleLength);
+	if ( position == NULL )
 	{
-		iret = memcmp(input+inputOffset, needle, needleLength);
-		if ( iret == 0 )
-		{
-			// we have a match
-			if ( out_position_in_input )
-			{
-				*out_position_in_input = input + inputOffset;
-			}
-			return 1;
-		}
-		inputOffset += 1;
-		inputLengthRemaining -= 1;
+		return 0;
 	}
-	
-	return 0;
+
+	// we have a match
+	if ( out_position_in_input )
+	{
+		*out_position_in_input = (unsigned char*)position;
+	}
+	return 1;
 }
 
 
@@ -2374,23 +2117,8 @@ int C_duplicateString(const char * input, char ** output, unsigned int * output_
 #if C_TOOLBOX_TIMING == 1
 unsigned int C_Timestamp()
 {
-	unsigned int retval=0;
-#if ( defined(_MSC_VER) )
-	retval = (unsigned int) timeGetTime();
-#else
-	struct timeval tv_date;
-	mtime_t delay; /* delay in msec, signed to detect errors */
-
-	/* see mdate() about gettimeofday() possible errors */
-	gettimeofday( &tv_date, NULL );
-
-	/* calculate delay and check if current date is before wished date */
-	delay = (mtime_t) tv_date.tv_sec * 1000000 + (mtime_t) tv_date.tv_usec;
-	delay = delay/1000;
-	retval = (unsigned int) delay;
-
-#endif
-	return retval;
+	// Modified 19.Oct.2026, monotonic so intervals survive date and NTP changes
+	return (unsigned int)(C_MonotonicNs() / 1000000);
 }
 
 #endif // end C_TOOLBOX_TIMING
@@ -59,6 +59,17 @@ extern "C" {
 #include "toolbox-flexstring.h"
 #include "toolbox-config.h"
 #include "toolbox-filesystem.h"
+#include "toolbox-search.h"
+#include "toolbox-date.h"
+#include "toolbox-hex.h"
+#include "toolbox-numeric.h"
+#include "toolbox-route.h"
+#include "toolbox-line-index.h"
+#include "toolbox-netstats.h"
+#include "toolbox-ifstatus.h"
+#include "toolbox-timing.h"
+#include "toolbox-random.h"
+#include "toolbox-xml-entity.h"
 
 #if C_TOOLBOX_CHARARRAY == 1
 #include "toolbox-line-parser.h"
@@ -109,6 +120,9 @@ typedef struct configArray
 #if C_TOOLBOX_GENERIC_TREE == 1
 #	include "toolbox-tree.h"
 #endif
+#if C_TOOLBOX_GENERIC_TREE_SNAPSHOT == 1
+#	include "toolbox-tree-snapshot.h"
+#endif
 
 typedef enum gnucFlags
 {
@@ -124,6 +138,7 @@ typedef enum gnucEnums
 
 #define CONFIG_ARRAY_ROW_AMOUNT 100
 #define TOOLBOX_DEBUG_LEVEL 0
+#include "toolbox-log.h" // after TOOLBOX_DEBUG_LEVEL, it sets which log levels are compiled
 
 
 int TOOLBOX_endSlashDirectory(char * directory_inout); // prepare directory to have filename appended
@@ -132,20 +147,25 @@ int wchar_extract_path(const wchar_t * source, wchar_t * destination, int destin
 int wchar_extract_filename(const wchar_t * source, wchar_t * destination, int destination_size);
 
 
-// Wide (wchar_t) is UTF-16
+// Wide (wchar_t) is UTF-16, or UTF-32 where wchar_t is 32 bits. Sizes are in bytes.
+// Invalid input becomes U+FFFD. Output is always terminated,
+// TOOLBOX_ERROR_BUFFER_TOO_SMALL if it was cut. See toolbox-utf8.c
 int TOOLBOX_charToWide(const char * original, wchar_t * utf16, unsigned int utf16_size);
 int TOOLBOX_utf8ToWide(const char * utf8, wchar_t * utf16, unsigned int utf16_size);
 int TOOLBOX_utf8ToWideAlloc(const char * utf8, wchar_t ** utf16, unsigned int * utf16_size);
 int TOOLBOX_utf16ToChar(const wchar_t * utf16, char * writeme, unsigned int writeme_size);
 int TOOLBOX_utf16ToUtf8(const wchar_t * utf16, char * writeme, unsigned int writeme_size);
 
-// convert &quot; to " and more
+// convert &quot; to " and more, in place in one pass. temp and temp_size are unused (can be NULL),
+// see C_xmlDecodeEntities and xmlEntityDecoder_T for chunked input
 int TOOLBOX_DecodeXmlTextBlobs(char * source, char ** temp, unsigned int * temp_size);
 
 // UTF-8 toolbox :)
 // utf8_buffer_size can be -1 if you don't know.. but string MUST be terminated.
 int TOOLBOX_utf8strlen(const char * utf8, int utf8_buffer_size);
 char * TOOLBOX_utf8EndOfString(const char * utf8, int utf8_buffer_size);
+// 1 if well formed (no overlong, surrogate or truncated sequence), 0 otherwise
+int TOOLBOX_utf8IsValid(const char * utf8, int utf8_buffer_size);
 
 // will realloc the string if too small, or malloc it if NULL
 // separator is optional and can be NULL
@@ -157,20 +177,17 @@ int C_AppendUtf8toWide(wchar_t ** string, unsigned int * buffersize, const char
 extern FILE * g_toolbox_toolbox_log_file;
 #endif
 
-int C_itoa( unsigned int i, char * toLoad, unsigned int toLoad_size );
-int C_axtoi(const char * hex);
+int C_itoa( unsigned int i, char * toLoad, unsigned int toLoad_size ); // see C_u32toa, which returns the length
+int C_axtoi(const char * hex); // saturates at 0xFFFFFFFF, see C_hexParseU64 for 64 bits
+#define TOOLBOX_atoi64(a) C_atoi64(a)
 #if defined(_MSC_VER)
 #	if defined(atoi64)
-#		define TOOLBOX_atoi64(a) atoi64(a)
 #		define TOOLBOX_atoi64W(a) wtoi64(a)
 #		define TOOLBOX_atoiW(a) wtoi(a)
 #	else
-#		define TOOLBOX_atoi64(a) _atoi64(a)
 #		define TOOLBOX_atoi64W(a) _wtoi64(a)
 #		define TOOLBOX_atoiW(a) _wtoi(a)
 #	endif
-#else
-#	define TOOLBOX_atoi64(a) atoll(a)
 #endif
 char* C_strreplace(char * source, const char token, const char replacement);
 int C_strncpy(char * destination, const char * source, int dst_max_length);
@@ -205,10 +222,32 @@ int C_MoveFile(const char * source, const char * destination); // will overwrite
 int C_MoveFileEx(const char * source, const char * destination, int flags); // flags are from gnucFlags_E
 
 
-#if defined(__C_TOOLBOX_TEXT_BUFFER_READER_H__)
+#define TOOLBOX_NETWORK_INFORMATION_FIELD_SIZE 64
+
+typedef struct networkInformation_S
+{
+	char machine_ip[TOOLBOX_NETWORK_INFORMATION_FIELD_SIZE];
+	char subnet[TOOLBOX_NETWORK_INFORMATION_FIELD_SIZE];
+	char broadcast[TOOLBOX_NETWORK_INFORMATION_FIELD_SIZE];
+	char mac[TOOLBOX_NETWORK_INFORMATION_FIELD_SIZE];
+	char RX_packets[TOOLBOX_NETWORK_INFORMATION_FIELD_SIZE];
+	char RX_errors[TOOLBOX_NETWORK_INFORMATION_FIELD_SIZE];
+	char RX_bytes[TOOLBOX_NETWORK_INFORMATION_FIELD_SIZE];
+	char TX_packets[TOOLBOX_NETWORK_INFORMATION_FIELD_SIZE];
+	char TX_errors[TOOLBOX_NETWORK_INFORMATION_FIELD_SIZE];
+	char TX_bytes[TOOLBOX_NETWORK_INFORMATION_FIELD_SIZE];
+	char collisions[TOOLBOX_NETWORK_INFORMATION_FIELD_SIZE];
+} networkInformation_T;
+
+// Parses ifconfig (net-tools 1.x "inet addr:" or 2.x "inet ... netmask") or ipconfig /all output
+// in one pass over the interface block. Returns 0 if the interface is not found.
+// which_interface NULL or empty picks the first interface that is not loopback.
+int C_ParseNetworkInformation(const char * ifconfig, const char * which_interface, networkInformation_T * info);
+
 // Returns 0 if not found and which_interface was provided
 // Set "which_interface" to NULL or empty string to not specify any interface
 // otherwise will pickup first interface (normally first wired interface)
+// Output buffers must hold TOOLBOX_NETWORK_INFORMATION_FIELD_SIZE chars, any can be NULL.
 int C_GetNetworkInformation(char * machine_ip,
 							   char * subnet,
 							   char * broadcast,
@@ -223,15 +262,28 @@ int C_GetNetworkInformation(char * machine_ip,
 							   char * ifconfig, /*INOUT*/
 							   int ifconfig_size,
 							   const char * which_interface );
-#endif
 
-#if defined(__TOOLBOX_NETWORK_H__)
+#if !defined(_MSC_VER) || defined(__TOOLBOX_NETWORK_H__)
 int C_GetHostname(char * hostname, int hostname_bufsize);
+
+// Hostname read once and kept until the kernel reports a change
+// (poll on /proc/sys/kernel/hostname), so it is cheap to ask on every refresh.
+// Without the proc file (not Linux) every call asks the system.
+#define TOOLBOX_HOSTNAME_SIZE 256
+typedef struct hostnameCache_S
+{
+	char hostname[TOOLBOX_HOSTNAME_SIZE];
+	int valid;
+	int fd;
+} hostnameCache_T;
+
+int hostnameCache_Constructor(hostnameCache_T * cache);
+int hostnameCache_Destructor(hostnameCache_T * cache);
+int hostnameCache_Get(hostnameCache_T * cache, char * hostname, int hostname_bufsize);
 #endif
 
-#if defined(__C_TOOLBOX_TEXT_BUFFER_READER_H__)
+// IPv4 default gateway, see C_GetDefaultRoutes for IPv6 and metrics
 int C_GetDefaultGateway(char * gateway, int gateway_bufsize);
-#endif
 
 // timing functions
 int C_Sleep(int milliseconds);
@@ -246,6 +298,7 @@ int C_duplicateString(const char * input, char ** output, unsigned int * output_
 
 #if C_TOOLBOX_TIMING == 1
 unsigned int C_Timestamp();
+// local "YYYY-MM-DD HH:MM:SS.mmm", loadme_size of TOOLBOX_TIMESTRING_SIZE is enough
 int C_Timestring(char * loadme, unsigned int loadme_size);
 int C_TimestringW(wchar_t * loadme, unsigned int loadme_size);
 // year with four letters
@@ -263,6 +316,7 @@ int C_GetTempFilename(const char * path, char * out_filename);
 int C_isDigit(const char * string);
 int C_isMulticast(const char * string);
 
+// lowercase hex of length bytes, see C_hexEncode
 int C_hexToString(unsigned char * hex, unsigned int length, char * loadme, unsigned int loadme_length);
 
 